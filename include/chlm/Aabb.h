@@ -0,0 +1,196 @@
+//
+// Created by Zack Shrout on 10/16/26.
+// Copyright (c) 2026 BunnySoft. All rights reserved.
+//
+
+#pragma once
+
+#include "Core.h"
+#include "Vector.h"
+#include "Matrix4x4.h"
+
+namespace chlm {
+    /**
+     * @brief Axis-aligned bounding box in 3D.
+     *
+     * Stored as minimum and maximum corners in float4 registers (w is kept at 0), so every
+     * operation is a handful of lane-wise min/max/compare instructions.
+     *
+     * Unlike the rectangles in Rect.h, both corners are **inclusive**: a point lying exactly
+     * on the max corner is inside the box.
+     *
+     * A default-constructed box is *inverted* (min = +inf, max = -inf). It is empty() and acts
+     * as the identity for merge(), so bounds can be accumulated with:
+     *
+     * `aabb3 bounds; for (p : points) bounds = merge(bounds, p);`
+     */
+    struct aabb3
+    {
+        float4 min{ infinity, infinity, infinity, 0.f };
+        float4 max{ -infinity, -infinity, -infinity, 0.f };
+    };
+
+    /**
+     * @brief Creates a box from its minimum and maximum corners.
+     *
+     * @param min Minimum corner.
+     * @param max Maximum corner.
+     * @return Box spanning [min, max].
+     */
+    [[nodiscard]] constexpr aabb3 make_aabb(const float3 min, const float3 max) noexcept
+    {
+        return aabb3{ float4{ min.x, min.y, min.z, 0.f }, float4{ max.x, max.y, max.z, 0.f } };
+    }
+
+    /**
+     * @brief Returns the center of a box.
+     *
+     * @param box Box to query.
+     * @return (min + max) / 2.
+     */
+    [[nodiscard]] constexpr float3 aabb_center(const aabb3& box) noexcept
+    {
+        return ((box.min + box.max) * .5f).xyz;
+    }
+
+    /**
+     * @brief Returns the half-size of a box along each axis.
+     *
+     * @param box Box to query.
+     * @return (max - min) / 2.
+     */
+    [[nodiscard]] constexpr float3 aabb_extents(const aabb3& box) noexcept
+    {
+        return ((box.max - box.min) * .5f).xyz;
+    }
+
+    /**
+     * @brief Returns whether a box is empty.
+     *
+     * A box is empty if its minimum exceeds its maximum on any axis (including the
+     * default-constructed inverted box). A degenerate box with min == max is not empty.
+     *
+     * @param box Box to test.
+     * @return true if the box contains no points, otherwise false.
+     */
+    [[nodiscard]] inline bool empty(const aabb3& box) noexcept
+    {
+        return detail::movemask(box.min > box.max) != 0;
+    }
+
+    /**
+     * @brief Returns the smallest box containing two boxes.
+     *
+     * @param a First box.
+     * @param b Second box.
+     * @return Union of the bounds of @p a and @p b.
+     */
+    [[nodiscard]] constexpr aabb3 merge(const aabb3& a, const aabb3& b) noexcept
+    {
+        return aabb3{ min(a.min, b.min), max(a.max, b.max) };
+    }
+
+    /**
+     * @brief Returns the smallest box containing a box and a point.
+     *
+     * @param box   Box to grow.
+     * @param point Point to include.
+     * @return Grown box.
+     */
+    [[nodiscard]] constexpr aabb3 merge(const aabb3& box, const float3 point) noexcept
+    {
+        const float4 p{ point.x, point.y, point.z, 0.f };
+        return aabb3{ min(box.min, p), max(box.max, p) };
+    }
+
+    /**
+     * @brief Returns the overlap of two boxes.
+     *
+     * @param a First box.
+     * @param b Second box.
+     * @return Intersection box; empty() if the boxes do not overlap.
+     */
+    [[nodiscard]] constexpr aabb3 intersection(const aabb3& a, const aabb3& b) noexcept
+    {
+        return aabb3{ max(a.min, b.min), min(a.max, b.max) };
+    }
+
+    /**
+     * @brief Returns whether two boxes overlap (touching counts as overlapping).
+     *
+     * @param a First box.
+     * @param b Second box.
+     * @return true if the boxes share at least one point, otherwise false.
+     */
+    [[nodiscard]] inline bool intersects(const aabb3& a, const aabb3& b) noexcept
+    {
+        return detail::movemask((a.min > b.max) | (b.min > a.max)) == 0;
+    }
+
+    /**
+     * @brief Returns whether a point lies inside a box (both corners inclusive).
+     *
+     * @param box   Box to test against.
+     * @param point Point to test.
+     * @return true if min <= point <= max on every axis, otherwise false.
+     */
+    [[nodiscard]] inline bool contains(const aabb3& box, const float3 point) noexcept
+    {
+        const float4 p{ point.x, point.y, point.z, 0.f };
+        return detail::movemask((p < box.min) | (p > box.max)) == 0;
+    }
+
+    /**
+     * @brief Returns whether a box lies entirely inside another box.
+     *
+     * @param outer Containing box.
+     * @param inner Box to test.
+     * @return true if @p inner is within @p outer on every axis, otherwise false.
+     */
+    [[nodiscard]] inline bool contains(const aabb3& outer, const aabb3& inner) noexcept
+    {
+        return detail::movemask((inner.min < outer.min) | (inner.max > outer.max)) == 0;
+    }
+
+    /**
+     * @brief Returns the surface area of a box (the SAH cost metric).
+     *
+     * @param box Box to measure.
+     * @return 2 * (dx*dy + dy*dz + dz*dx), or 0 for an empty box.
+     */
+    [[nodiscard]] inline float surface_area(const aabb3& box) noexcept
+    {
+        if (empty(box))
+            return 0.f;
+
+        const float4 d{ box.max - box.min };
+        return 2.f * hsum(d.xyzw * d.yzxw);
+    }
+
+    /**
+     * @brief Transforms a box and returns the axis-aligned box that bounds the result.
+     *
+     * Uses Arvo's method in center/extent form: the center is transformed as a point and
+     * the extents by the absolute value of the 3x3 part, so all eight corners are bounded
+     * without transforming them individually. The projective row is ignored.
+     *
+     * @param m   Affine transformation matrix.
+     * @param box Box to transform.
+     * @return Tight axis-aligned bounds of the transformed box (empty boxes are returned unchanged).
+     */
+    [[nodiscard]] inline aabb3 transform(const float4x4& m, const aabb3& box) noexcept
+    {
+        if (empty(box))
+            return box;
+
+        const float4 c{ (box.min + box.max) * .5f };
+        const float4 e{ (box.max - box.min) * .5f };
+
+        float4 center{ c.x * m.columns[0] + c.y * m.columns[1] + c.z * m.columns[2] + m.columns[3] };
+        float4 extents{ e.x * abs(m.columns[0]) + e.y * abs(m.columns[1]) + e.z * abs(m.columns[2]) };
+        center.w = 0.f;
+        extents.w = 0.f;
+
+        return aabb3{ center - extents, center + extents };
+    }
+} // namespace chlm
@@ -0,0 +1,321 @@
+//
+// Created by Zack Shrout on 10/16/26.
+// Copyright (c) 2026 BunnySoft. All rights reserved.
+//
+
+#pragma once
+
+#include "Core.h"
+#include "Dispatch.h"
+#include "Vector.h"
+#include "Quaternion.h"
+#include "SoA.h"
+
+#include <algorithm>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace chlm {
+    // ========================================
+    // Animation clips (keyframe tracks)
+    // ========================================
+    // A clip has three channels (translation, rotation, scale). Each channel keeps the
+    // keys of all its tracks in two flat arrays (times and values), with each track's
+    // keys contiguous, so sampling a track touches at most two adjacent keys.
+    //
+    // Tracks with evenly spaced keys are detected when added and indexed directly from
+    // the time. Other tracks are found through a per-track cursor (animation_cursor):
+    // during sequential playback the key is the cached one or one of the next few, so
+    // sampling is O(1). Jumps and looping fall back to one binary search per track.
+
+    /**
+     * @brief Location and timing of one track's keys inside an animation_channel.
+     */
+    struct animation_track
+    {
+        uint32_t first_key{ 0 };   // index of the first key in the channel arrays
+        uint32_t key_count{ 0 };   // number of keys (at least 1)
+        float start_time{ 0.f };   // time of the first key
+        float inv_interval{ 0.f }; // 1 / key spacing for uniform tracks, 0 for non-uniform
+    };
+
+    /**
+     * @brief All tracks of one channel (e.g. every joint's rotation keys).
+     *
+     * @tparam T float3 (translation / scale) or quat (rotation).
+     */
+    template<typename T>
+    struct animation_channel
+    {
+        std::vector<animation_track> tracks; // one per joint
+        std::vector<float> times;            // key times, parallel to values
+        std::vector<T> values;               // key values, grouped by track
+    };
+
+    /**
+     * @brief Translation, rotation and scale tracks of a clip, one track per joint and channel.
+     */
+    struct animation_clip
+    {
+        float duration{ 0.f }; // time of the last key over all tracks
+        animation_channel<float3> translation;
+        animation_channel<quat> rotation;
+        animation_channel<float3> scale;
+    };
+
+    /**
+     * @brief Last key segment used per track, carried between sample() calls.
+     *
+     * Use one cursor per playing instance of a clip. A default-constructed cursor is
+     * valid: it is sized on first use and any stale position is corrected by the search.
+     */
+    struct animation_cursor
+    {
+        std::vector<uint32_t> translation;
+        std::vector<uint32_t> rotation;
+        std::vector<uint32_t> scale;
+    };
+
+    /**
+     * @brief Appends a track with arbitrary key times to a channel.
+     *
+     * Evenly spaced key times (within 1e-5 relative) are recognized and stored as a
+     * uniform track, which is sampled without a search.
+     *
+     * @param channel Channel to extend.
+     * @param times   Strictly increasing key times.
+     * @param values  Key values (same size as @p times, at least one key).
+     * @return Index of the new track in channel.tracks.
+     */
+    template<typename T>
+    inline uint32_t add_track(animation_channel<T>& channel, const std::span<const float> times,
+                              const std::span<const T> values)
+    {
+        assert(!times.empty() && times.size() == values.size());
+
+        animation_track track{ static_cast<uint32_t>(channel.values.size()), static_cast<uint32_t>(times.size()),
+                               times.front(), 0.f };
+
+        if (times.size() > 1)
+        {
+            const float interval{ (times.back() - times.front()) / static_cast<float>(times.size() - 1) };
+            const float tolerance{ 1e-5f * max(abs(times.back()), 1.f) };
+
+            bool uniform{ interval > 0.f };
+            for (size_t i{ 1 }; uniform && i + 1 < times.size(); ++i)
+                uniform = abs(times[i] - (times.front() + interval * static_cast<float>(i))) <= tolerance;
+
+            if (uniform)
+                track.inv_interval = 1.f / interval;
+        }
+
+        channel.tracks.push_back(track);
+        channel.times.insert(channel.times.end(), times.begin(), times.end());
+        channel.values.insert(channel.values.end(), values.begin(), values.end());
+        return static_cast<uint32_t>(channel.tracks.size() - 1);
+    }
+
+    /**
+     * @brief Appends a track whose keys are sampled at a fixed rate.
+     *
+     * @param channel    Channel to extend.
+     * @param start_time Time of the first key.
+     * @param interval   Time between keys (positive).
+     * @param values     Key values (at least one key).
+     * @return Index of the new track in channel.tracks.
+     */
+    template<typename T>
+    inline uint32_t add_uniform_track(animation_channel<T>& channel, const float start_time, const float interval,
+                                      const std::span<const T> values)
+    {
+        assert(!values.empty() && interval > 0.f);
+
+        channel.tracks.push_back(animation_track{ static_cast<uint32_t>(channel.values.size()),
+                                                  static_cast<uint32_t>(values.size()), start_time, 1.f / interval });
+        for (size_t i{ 0 }; i < values.size(); ++i)
+            channel.times.push_back(start_time + interval * static_cast<float>(i));
+        channel.values.insert(channel.values.end(), values.begin(), values.end());
+        return static_cast<uint32_t>(channel.tracks.size() - 1);
+    }
+
+    /**
+     * @brief Recomputes clip.duration from the last key of every track.
+     *
+     * @param clip Clip whose tracks were added or edited.
+     */
+    inline void update_duration(animation_clip& clip) noexcept
+    {
+        float duration{ 0.f };
+        const auto last_key{ [&](const auto& channel)
+        {
+            for (const animation_track& track : channel.tracks)
+                duration = max(duration, channel.times[track.first_key + track.key_count - 1]);
+        } };
+
+        last_key(clip.translation);
+        last_key(clip.rotation);
+        last_key(clip.scale);
+        clip.duration = duration;
+    }
+
+    namespace detail {
+        /**
+         * @brief Returns the segment k in [0, count - 2] with times[k] <= t < times[k + 1] (clamped).
+         *
+         * Steps forward from @p cursor for a few keys before falling back to a binary search.
+         */
+        [[nodiscard]] CHLM_INLINE uint32_t find_key_segment(const float* times, const uint32_t count, const float t,
+                                                            const uint32_t cursor) noexcept
+        {
+            uint32_t k{ min(cursor, count - 2) };
+            if (t >= times[k])
+            {
+                for (int step{ 0 }; step < 4; ++step, ++k)
+                {
+                    if (k == count - 2 || t < times[k + 1])
+                        return k;
+                }
+            }
+
+            const float* it{ std::upper_bound(times + 1, times + count - 1, t) };
+            return static_cast<uint32_t>(it - times - 1);
+        }
+
+        /**
+         * @brief Finds the two keys around @p time for one track and the blend factor between them.
+         */
+        template<typename T>
+        CHLM_INLINE void locate_keys(const animation_channel<T>& channel, const animation_track& track, const float time,
+                                     uint32_t& cursor, uint32_t& key, float& alpha) noexcept
+        {
+            if (track.key_count < 2)
+            {
+                key = track.first_key;
+                alpha = 0.f;
+                return;
+            }
+
+            uint32_t k;
+            if (track.inv_interval > 0.f)
+            {
+                const float f{ clamp((time - track.start_time) * track.inv_interval, 0.f,
+                                     static_cast<float>(track.key_count - 1)) };
+                k = min(static_cast<uint32_t>(f), track.key_count - 2);
+                alpha = f - static_cast<float>(k);
+            }
+            else
+            {
+                const float* times{ channel.times.data() + track.first_key };
+                k = find_key_segment(times, track.key_count, time, cursor);
+
+                const float span{ times[k + 1] - times[k] };
+                alpha = span > 0.f ? clamp((time - times[k]) / span, 0.f, 1.f) : 0.f;
+            }
+
+            cursor = k;
+            key = track.first_key + k;
+        }
+
+        /**
+         * @brief Samples every track of a channel into SoA output, eight tracks per block.
+         *
+         * The two keys of each track are gathered into float8 lanes, then the whole block
+         * is interpolated at once: lerp for float3 channels, slerp_lanes() for rotations.
+         */
+        template<typename T, typename Soa>
+        inline void sample_channel(const animation_channel<T>& channel, const float time,
+                                   std::vector<uint32_t>& cursors, Soa& out)
+        {
+            constexpr bool is_rotation{ std::is_same_v<T, quat> };
+
+            const size_t count{ channel.tracks.size() };
+            cursors.resize(count, 0);
+            out.resize(count);
+
+            float* xs{ out.x().data() };
+            float* ys{ out.y().data() };
+            float* zs{ out.z().data() };
+            float* ws{ nullptr };
+            if constexpr (is_rotation)
+                ws = out.w().data();
+
+            dispatch([&]() CHLM_KERNEL
+            {
+                // count <= padded_size() and blocks start at multiples of 8, so every store fits
+                for (size_t base{ 0 }; base < count; base += 8)
+                {
+                    float8 ax{ }, ay{ }, az{ }, aw{ };
+                    float8 bx{ }, by{ }, bz{ }, bw{ };
+                    float8 alpha{ };
+
+                    const size_t n{ min<size_t>(count - base, 8) };
+                    for (size_t j{ 0 }; j < n; ++j)
+                    {
+                        const animation_track& track{ channel.tracks[base + j] };
+
+                        uint32_t key;
+                        float a;
+                        locate_keys(channel, track, time, cursors[base + j], key, a);
+
+                        const uint32_t next{ track.key_count > 1 ? key + 1 : key };
+                        const T va{ channel.values[key] };
+                        const T vb{ channel.values[next] };
+
+                        ax[j] = va.x;
+                        ay[j] = va.y;
+                        az[j] = va.z;
+                        bx[j] = vb.x;
+                        by[j] = vb.y;
+                        bz[j] = vb.z;
+                        if constexpr (is_rotation)
+                        {
+                            aw[j] = va.w;
+                            bw[j] = vb.w;
+                        }
+                        alpha[j] = a;
+                    }
+
+                    if constexpr (is_rotation)
+                    {
+                        float8 x, y, z, w;
+                        slerp_lanes(ax, ay, az, aw, bx, by, bz, bw, alpha, x, y, z, w);
+                        store(xs + base, x, store_hint::cached);
+                        store(ys + base, y, store_hint::cached);
+                        store(zs + base, z, store_hint::cached);
+                        store(ws + base, w, store_hint::cached);
+                    }
+                    else
+                    {
+                        store(xs + base, ax + (bx - ax) * alpha, store_hint::cached);
+                        store(ys + base, ay + (by - ay) * alpha, store_hint::cached);
+                        store(zs + base, az + (bz - az) * alpha, store_hint::cached);
+                    }
+                }
+            });
+        }
+    } // namespace detail
+
+    /**
+     * @brief Samples every track of a clip at one time.
+     *
+     * Translations and scales are interpolated linearly; rotations use the polynomial
+     * slerp of slerp_fast() along the shortest arc. Times before the first key or after
+     * the last key of a track hold that key. For looping playback, wrap @p time into
+     * [0, clip.duration] first.
+     *
+     * @param clip         Clip to sample.
+     * @param time         Sample time.
+     * @param cursor       Per-track key cursors of this playing instance (updated).
+     * @param translations Receives one translation per translation track.
+     * @param rotations    Receives one rotation per rotation track.
+     * @param scales       Receives one scale per scale track.
+     */
+    inline void sample(const animation_clip& clip, const float time, animation_cursor& cursor,
+                       float3_soa& translations, quat_soa& rotations, float3_soa& scales)
+    {
+        detail::sample_channel(clip.translation, time, cursor.translation, translations);
+        detail::sample_channel(clip.rotation, time, cursor.rotation, rotations);
+        detail::sample_channel(clip.scale, time, cursor.scale, scales);
+    }
+} // namespace chlm
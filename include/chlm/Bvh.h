@@ -0,0 +1,494 @@
+//
+// Created by Zack Shrout on 10/16/26.
+// Copyright (c) 2026 BunnySoft. All rights reserved.
+//
+
+#pragma once
+
+#include "Core.h"
+#include "Vector.h"
+#include "Aabb.h"
+#include "Frustum.h"
+#include "Ray.h"
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace chlm {
+    // ========================================
+    // BVH4 - 4-wide bounding volume hierarchy
+    // ========================================
+    // Built top-down as a binary tree with binned SAH, then collapsed so every node
+    // stores the bounds of up to four children in SoA form. A ray or frustum then
+    // tests all four children of a node with one pass of float4 math.
+
+    /**
+     * @brief Node of a bvh4: bounds and links of up to four children.
+     *
+     * Child slot i is occupied when bit i of child_mask is set. An occupied slot is a leaf
+     * when count[i] > 0 (child[i] is then the first entry in bvh4::primitives) and an inner
+     * node otherwise (child[i] is an index into bvh4::nodes).
+     */
+    struct alignas(16) bvh4_node
+    {
+        float min_x[4]{ infinity, infinity, infinity, infinity };
+        float min_y[4]{ infinity, infinity, infinity, infinity };
+        float min_z[4]{ infinity, infinity, infinity, infinity };
+        float max_x[4]{ -infinity, -infinity, -infinity, -infinity };
+        float max_y[4]{ -infinity, -infinity, -infinity, -infinity };
+        float max_z[4]{ -infinity, -infinity, -infinity, -infinity };
+        uint32_t child[4]{ };
+        uint32_t count[4]{ };
+        uint32_t child_mask{ 0 };
+    };
+
+    /**
+     * @brief Bounding volume hierarchy over a set of primitive bounding boxes.
+     *
+     * nodes[0] is the root. Leaves reference ranges of `primitives`, which holds the
+     * caller's primitive indices reordered so each leaf's primitives are contiguous.
+     */
+    struct bvh4
+    {
+        std::vector<bvh4_node> nodes;
+        std::vector<uint32_t> primitives;
+        aabb3 bounds;
+    };
+
+    /** @brief Maximum depth of the binary build tree; deeper subtrees become (larger) leaves. */
+    constexpr uint32_t bvh_max_depth{ 64 };
+
+    /** @brief Traversal stack capacity; enough for a full tree of bvh_max_depth levels. */
+    constexpr uint32_t bvh_stack_size{ 3 * bvh_max_depth + 1 };
+
+    namespace detail {
+        /**
+         * @brief Temporary binary node produced by the SAH builder.
+         */
+        struct bvh_build_node
+        {
+            aabb3 bounds;
+            uint32_t first{ 0 };
+            uint32_t count{ 0 };
+            std::unique_ptr<bvh_build_node> left;
+            std::unique_ptr<bvh_build_node> right;
+
+            [[nodiscard]] bool leaf() const noexcept { return !left; }
+        };
+
+        /**
+         * @brief Inputs shared by every recursion level of the builder.
+         */
+        struct bvh_build_context
+        {
+            std::span<const aabb3> boxes;
+            std::span<const float4> centroids;
+            std::span<uint32_t> indices;
+            uint32_t max_leaf_size;
+            bool parallel;
+        };
+
+        constexpr int bvh_bins{ 16 };
+        constexpr uint32_t bvh_parallel_threshold{ 4096 };  // primitives per subtree worth a task
+        constexpr uint32_t bvh_parallel_depth{ 6 };         // at most 2^6 concurrent subtree tasks
+
+        /**
+         * @brief Recursively builds the binary tree for indices [first, first + count).
+         *
+         * Splits along the axis of largest centroid extent at the bin boundary with the
+         * lowest SAH cost; keeps a leaf when splitting costs more than intersecting all
+         * primitives. The left subtree of large nodes is built by a std::async task.
+         */
+        inline std::unique_ptr<bvh_build_node> build_binary(const bvh_build_context& ctx, const uint32_t first,
+                                                            const uint32_t count, const uint32_t depth)
+        {
+            auto node{ std::make_unique<bvh_build_node>() };
+            node->first = first;
+            node->count = count;
+
+            aabb3 centroid_bounds;
+            for (uint32_t i{ first }; i < first + count; ++i)
+            {
+                const uint32_t prim{ ctx.indices[i] };
+                node->bounds = merge(node->bounds, ctx.boxes[prim]);
+                centroid_bounds = merge(centroid_bounds, ctx.centroids[prim].xyz);
+            }
+
+            if (count <= 1 || depth >= bvh_max_depth)
+                return node;
+
+            const float4 extent{ centroid_bounds.max - centroid_bounds.min };
+            const int axis{ extent.x >= extent.y && extent.x >= extent.z ? 0 : extent.y >= extent.z ? 1 : 2 };
+
+            // A denormal extent overflows the bin scale to inf; treat it like coincident centroids
+            const float scale{ bvh_bins / extent[axis] };
+
+            uint32_t mid;
+            if (!(extent[axis] > 0.f) || !(scale < infinity))
+            {
+                // All centroids coincide: SAH cannot separate them, so halve the range
+                if (count <= ctx.max_leaf_size)
+                    return node;
+                mid = first + count / 2;
+            }
+            else
+            {
+                const float origin{ centroid_bounds.min[axis] };
+                const auto bin_of{ [&](const uint32_t prim)
+                {
+                    return min(static_cast<int>((ctx.centroids[prim][axis] - origin) * scale), bvh_bins - 1);
+                } };
+
+                aabb3 bin_bounds[bvh_bins];
+                uint32_t bin_counts[bvh_bins]{ };
+                for (uint32_t i{ first }; i < first + count; ++i)
+                {
+                    const uint32_t prim{ ctx.indices[i] };
+                    const int b{ bin_of(prim) };
+                    bin_bounds[b] = merge(bin_bounds[b], ctx.boxes[prim]);
+                    ++bin_counts[b];
+                }
+
+                // Sweep from the right, then from the left, evaluating every bin boundary
+                float right_cost[bvh_bins]{ };
+                aabb3 accum;
+                uint32_t accum_count{ 0 };
+                for (int b{ bvh_bins - 1 }; b > 0; --b)
+                {
+                    accum = merge(accum, bin_bounds[b]);
+                    accum_count += bin_counts[b];
+                    right_cost[b] = surface_area(accum) * static_cast<float>(accum_count);
+                }
+
+                int best_split{ 1 };
+                float best_cost{ infinity };
+                accum = aabb3{ };
+                accum_count = 0;
+                for (int b{ 1 }; b < bvh_bins; ++b)
+                {
+                    accum = merge(accum, bin_bounds[b - 1]);
+                    accum_count += bin_counts[b - 1];
+                    if (const float cost{ surface_area(accum) * static_cast<float>(accum_count) + right_cost[b] };
+                        cost < best_cost)
+                    {
+                        best_cost = cost;
+                        best_split = b;
+                    }
+                }
+
+                // SAH with unit traversal and intersection costs: C = 1 + (A_L N_L + A_R N_R) / A
+                const float split_cost{ 1.f + best_cost / surface_area(node->bounds) };
+                if (count <= ctx.max_leaf_size && split_cost >= static_cast<float>(count))
+                    return node;
+
+                const auto begin{ ctx.indices.begin() + first };
+                mid = static_cast<uint32_t>(std::partition(begin, begin + count, [&](const uint32_t prim)
+                {
+                    return bin_of(prim) < best_split;
+                }) - ctx.indices.begin());
+            }
+
+            const uint32_t left_count{ mid - first };
+            if (ctx.parallel && count >= bvh_parallel_threshold && depth < bvh_parallel_depth)
+            {
+                auto left{ std::async(std::launch::async, [&ctx, first, left_count, depth]
+                {
+                    return build_binary(ctx, first, left_count, depth + 1);
+                }) };
+                node->right = build_binary(ctx, mid, count - left_count, depth + 1);
+                node->left = left.get();
+            }
+            else
+            {
+                node->left = build_binary(ctx, first, left_count, depth + 1);
+                node->right = build_binary(ctx, mid, count - left_count, depth + 1);
+            }
+
+            return node;
+        }
+
+        /**
+         * @brief Writes a child slot of a bvh4 node.
+         */
+        inline void set_bvh4_slot(bvh4_node& node, const int slot, const aabb3& bounds,
+                                  const uint32_t child, const uint32_t count) noexcept
+        {
+            node.min_x[slot] = bounds.min.x;
+            node.min_y[slot] = bounds.min.y;
+            node.min_z[slot] = bounds.min.z;
+            node.max_x[slot] = bounds.max.x;
+            node.max_y[slot] = bounds.max.y;
+            node.max_z[slot] = bounds.max.z;
+            node.child[slot] = child;
+            node.count[slot] = count;
+            node.child_mask |= 1u << slot;
+        }
+
+        /**
+         * @brief Collapses an inner binary node into a bvh4 node and recurses.
+         *
+         * Repeatedly opens the inner child with the largest surface area until four
+         * children are collected (or only leaves remain).
+         *
+         * @return Index of the emitted node.
+         */
+        inline uint32_t collapse_bvh4(bvh4& bvh, const bvh_build_node& node)
+        {
+            const auto index{ static_cast<uint32_t>(bvh.nodes.size()) };
+            bvh.nodes.emplace_back();
+
+            const bvh_build_node* kids[4]{ node.left.get(), node.right.get() };
+            int kid_count{ 2 };
+            while (kid_count < 4)
+            {
+                int open{ -1 };
+                float open_area{ -1.f };
+                for (int i{ 0 }; i < kid_count; ++i)
+                {
+                    if (const float area{ surface_area(kids[i]->bounds) }; !kids[i]->leaf() && area > open_area)
+                    {
+                        open = i;
+                        open_area = area;
+                    }
+                }
+
+                if (open < 0)
+                    break;
+
+                const bvh_build_node* opened{ kids[open] };
+                kids[open] = opened->left.get();
+                kids[kid_count++] = opened->right.get();
+            }
+
+            for (int i{ 0 }; i < kid_count; ++i)
+            {
+                const bvh_build_node& kid{ *kids[i] };
+                // Recurse first: emplace_back may reallocate the node array
+                const uint32_t child{ kid.leaf() ? kid.first : collapse_bvh4(bvh, kid) };
+                set_bvh4_slot(bvh.nodes[index], i, kid.bounds, child, kid.leaf() ? kid.count : 0);
+            }
+
+            return index;
+        }
+
+        /**
+         * @brief Tests a ray (broadcast across lanes) against the four child boxes of a node.
+         *
+         * @return Bitmask of hit slots; @p t receives per-slot entry distances.
+         */
+        inline uint32_t raycast_bvh4_node(const bvh4_node& node, const float4 ox, const float4 oy, const float4 oz,
+                                          const float4 ix, const float4 iy, const float4 iz,
+                                          const float t_min, const float t_max, float4& t) noexcept
+        {
+            const float4 tx0{ (load<float4>(node.min_x) - ox) * ix };
+            const float4 tx1{ (load<float4>(node.max_x) - ox) * ix };
+            const float4 ty0{ (load<float4>(node.min_y) - oy) * iy };
+            const float4 ty1{ (load<float4>(node.max_y) - oy) * iy };
+            const float4 tz0{ (load<float4>(node.min_z) - oz) * iz };
+            const float4 tz1{ (load<float4>(node.max_z) - oz) * iz };
+
+            const float4 enter{ max(max(min(tx0, tx1), min(ty0, ty1)), max(min(tz0, tz1), float4{ } + t_min)) };
+            const float4 exit{ min(min(max(tx0, tx1), max(ty0, ty1)), min(max(tz0, tz1), float4{ } + t_max)) };
+
+            t = enter;
+            return movemask(enter <= exit) & node.child_mask;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Builds a bvh4 over primitive bounding boxes with binned SAH.
+     *
+     * @param boxes         Bounding box of every primitive; primitives are identified by index.
+     * @param max_leaf_size Largest primitive count a leaf may hold (SAH may stop earlier).
+     * @param parallel      Build large subtrees concurrently with std::async.
+     * @return The hierarchy (empty if @p boxes is empty).
+     */
+    inline bvh4 build_bvh4(const std::span<const aabb3> boxes, const uint32_t max_leaf_size = 4,
+                           const bool parallel = false)
+    {
+        bvh4 bvh;
+        const auto count{ static_cast<uint32_t>(boxes.size()) };
+        if (count == 0)
+            return bvh;
+
+        std::vector<float4> centroids(count);
+        bvh.primitives.resize(count);
+        for (uint32_t i{ 0 }; i < count; ++i)
+        {
+            centroids[i] = (boxes[i].min + boxes[i].max) * .5f;
+            bvh.primitives[i] = i;
+        }
+
+        const detail::bvh_build_context ctx{ boxes, centroids, bvh.primitives, max(max_leaf_size, 1u), parallel };
+        const std::unique_ptr<detail::bvh_build_node> root{ detail::build_binary(ctx, 0, count, 0) };
+        bvh.bounds = root->bounds;
+
+        if (root->leaf())
+        {
+            bvh.nodes.emplace_back();
+            detail::set_bvh4_slot(bvh.nodes[0], 0, root->bounds, root->first, root->count);
+        }
+        else
+        {
+            detail::collapse_bvh4(bvh, *root);
+        }
+
+        return bvh;
+    }
+
+    /**
+     * @brief Traverses a bvh4 along a ray, calling @p fn for every primitive in a leaf the ray reaches.
+     *
+     * Children are visited near to far. The callback receives the primitive index and a
+     * mutable copy of the ray: lowering r.t_max after a hit prunes everything farther away
+     * (closest hit), and returning true stops the traversal (any hit / occlusion).
+     *
+     * @tparam Fn Callable as bool fn(uint32_t primitive, ray& r).
+     * @param bvh Hierarchy to traverse.
+     * @param r   Ray to cast.
+     * @param fn  Primitive intersection callback.
+     */
+    template<typename Fn>
+    void raycast(const bvh4& bvh, ray r, const Fn& fn)
+    {
+        if (bvh.nodes.empty())
+            return;
+
+        const float4 ox{ float4{ } + r.origin.x };
+        const float4 oy{ float4{ } + r.origin.y };
+        const float4 oz{ float4{ } + r.origin.z };
+        const float4 ix{ 1.f / (float4{ } + r.direction.x) };
+        const float4 iy{ 1.f / (float4{ } + r.direction.y) };
+        const float4 iz{ 1.f / (float4{ } + r.direction.z) };
+
+        struct entry { uint32_t node; float t; };
+        entry stack[bvh_stack_size];
+        uint32_t top{ 0 };
+        stack[top++] = entry{ 0, r.t_min };
+
+        while (top > 0)
+        {
+            const entry e{ stack[--top] };
+            if (e.t > r.t_max)
+                continue;  // A closer hit was found after this node was pushed
+
+            const bvh4_node& node{ bvh.nodes[e.node] };
+            float4 t;
+            uint32_t hits{ detail::raycast_bvh4_node(node, ox, oy, oz, ix, iy, iz, r.t_min, r.t_max, t) };
+
+            // Sort hit slots near to far (at most four, insertion sort)
+            int order[4];
+            int hit_count{ 0 };
+            while (hits != 0)
+            {
+                const int slot{ __builtin_ctz(hits) };
+                hits &= hits - 1;
+
+                int j{ hit_count++ };
+                for (; j > 0 && t[order[j - 1]] > t[slot]; --j)
+                    order[j] = order[j - 1];
+                order[j] = slot;
+            }
+
+            // Leaves are intersected right away (nearest first); inner nodes are pushed far to near
+            for (int k{ 0 }; k < hit_count; ++k)
+            {
+                const int slot{ order[k] };
+                if (node.count[slot] == 0 || t[slot] > r.t_max)
+                    continue;
+
+                const uint32_t first{ node.child[slot] };
+                for (uint32_t p{ first }; p < first + node.count[slot]; ++p)
+                {
+                    if (fn(bvh.primitives[p], r))
+                        return;
+                }
+            }
+
+            for (int k{ hit_count - 1 }; k >= 0; --k)
+            {
+                const int slot{ order[k] };
+                if (node.count[slot] == 0)
+                {
+                    assert(top < bvh_stack_size);
+                    stack[top++] = entry{ node.child[slot], t[slot] };
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Calls @p fn for every primitive whose leaf bounds intersect a frustum.
+     *
+     * Each node's four children are tested against all six planes at once. Subtrees that
+     * are entirely inside the frustum are enumerated without further plane tests.
+     *
+     * @tparam Fn Callable as void fn(uint32_t primitive).
+     * @param bvh Hierarchy to traverse.
+     * @param f   Frustum to query.
+     * @param fn  Callback for each potentially visible primitive.
+     */
+    template<typename Fn>
+    void query_frustum(const bvh4& bvh, const frustum& f, const Fn& fn)
+    {
+        if (bvh.nodes.empty())
+            return;
+
+        constexpr uint32_t inside_flag{ 1u << 31 };
+        uint32_t stack[bvh_stack_size];
+        uint32_t top{ 0 };
+        stack[top++] = 0;
+
+        while (top > 0)
+        {
+            const uint32_t e{ stack[--top] };
+            const bvh4_node& node{ bvh.nodes[e & ~inside_flag] };
+
+            uint32_t visible{ node.child_mask };
+            uint32_t inside{ visible };
+            if ((e & inside_flag) == 0)
+            {
+                const float4 lo_x{ detail::load<float4>(node.min_x) }, hi_x{ detail::load<float4>(node.max_x) };
+                const float4 lo_y{ detail::load<float4>(node.min_y) }, hi_y{ detail::load<float4>(node.max_y) };
+                const float4 lo_z{ detail::load<float4>(node.min_z) }, hi_z{ detail::load<float4>(node.max_z) };
+                const float4 cx{ (lo_x + hi_x) * .5f }, ex{ (hi_x - lo_x) * .5f };
+                const float4 cy{ (lo_y + hi_y) * .5f }, ey{ (hi_y - lo_y) * .5f };
+                const float4 cz{ (lo_z + hi_z) * .5f }, ez{ (hi_z - lo_z) * .5f };
+
+                int4 outside_mask{ }, straddle_mask{ };
+                for (const float4 plane : f.planes)
+                {
+                    const float4 n{ abs(plane) };
+                    const float4 dist{ cx * plane.x + cy * plane.y + cz * plane.z + plane.w };
+                    const float4 radius{ ex * n.x + ey * n.y + ez * n.z };
+                    outside_mask |= dist < -radius;
+                    straddle_mask |= dist < radius;
+                }
+
+                visible &= ~detail::movemask(outside_mask);
+                inside = visible & ~detail::movemask(straddle_mask);
+            }
+
+            while (visible != 0)
+            {
+                const int slot{ __builtin_ctz(visible) };
+                visible &= visible - 1;
+
+                if (node.count[slot] > 0)
+                {
+                    const uint32_t first{ node.child[slot] };
+                    for (uint32_t p{ first }; p < first + node.count[slot]; ++p)
+                        fn(bvh.primitives[p]);
+                }
+                else
+                {
+                    assert(top < bvh_stack_size);
+                    stack[top++] = node.child[slot] | ((inside >> slot) & 1u ? inside_flag : 0u);
+                }
+            }
+        }
+    }
+} // namespace chlm
@@ -15,11 +15,16 @@
 // FEATURES:
 //   - float2, float3, float4 using Clang/GCC extended vector types
 //   - Quaternion (float4-based), float3x3 and float4x4 matrices (column-major)
+//   - float3x4 affine transforms (row-major, implicit {0,0,0,1} row)
+//   - Dual quaternions and linear-blend / dual-quaternion skinning
+//   - Keyframe animation clips with cursor-based SoA sampling
 //   - Core operations: dot, cross, normalize, lerp/slerp/nlerp
 //   - Matrix builders: translate, scale, rotate, look_at, perspective, ortho
 //   - Conversions: quat ↔ matrix, affine inverse, normal matrix
+//   - Smallest-three quaternion compression (32/48/64-bit)
 //   - Left- and right-handed variants for view/projection
 //   - Constants: pi, unit vectors (right/up/forward), epsilon, etc.
+//   - Batch kernels over spans with optional runtime ISA dispatch (Dispatch.h)
 //
 // CONVENTIONS:
 //   - Column-major matrices (HLSL/DirectX style)
@@ -39,10 +44,24 @@
 //
 // All functionality is brought in via the following headers (in dependency order):
 #include "Core.h"
+#include "Dispatch.h"
 #include "Vector.h"
 #include "Quaternion.h"
 #include "Matrix4x4.h"
 #include "Matrix3x3.h"
+#include "Matrix3x4.h"
 #include "MathConversions.h"
 #include "Rect.h"
+#include "SoA.h"
+#include "Packed.h"
+#include "PackedQuaternion.h"
+#include "Parallel.h"
+#include "TransformHierarchy.h"
+#include "DualQuaternion.h"
+#include "Skinning.h"
+#include "Animation.h"
+#include "Aabb.h"
+#include "Frustum.h"
+#include "Ray.h"
+#include "Bvh.h"
 #include "Utilities.h"
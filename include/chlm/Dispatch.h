@@ -0,0 +1,193 @@
+//
+// Created by Zack Shrout on 10/16/26.
+// Copyright (c) 2026 BunnySoft. All rights reserved.
+//
+
+#pragma once
+
+#include "Core.h"
+
+#include <cstdlib>
+#include <string_view>
+
+// ========================================
+// Runtime ISA dispatch for batch kernels
+// ========================================
+// CarrotHLM is header-only, so by default every kernel is compiled for the
+// consumer's -m flags. Defining CHLM_RUNTIME_DISPATCH (or configuring CMake with
+// -DCARROTHLM_RUNTIME_DISPATCH=ON) makes batch entry points re-instantiate their
+// kernel body for SSE4.2, AVX2 and AVX-512 and pick the widest one the CPU
+// supports on first use.
+//
+// Kernel bodies are written once as lambdas tagged CHLM_KERNEL (always_inline).
+// Inlining them into a function carrying a target attribute compiles the same
+// generic vector code for that instruction set. Helpers called from a kernel body
+// are only compiled for the target when they are inlined as well, so the library's
+// lane helpers (load/store, select, rsqrt, the *_lanes polynomials, ...) are
+// declared CHLM_INLINE. Any other function a kernel calls is a regular call built
+// for the baseline ISA: it is still correct, just narrower. Code paths chosen with
+// #if on __AVX__ / __SSE__ also follow the baseline flags, not the dispatched level.
+//
+// The environment variable CHLM_SIMD_LEVEL (scalar, sse2, sse4.2, avx2, avx512,
+// neon) caps the selected level for benchmarking. It can lower the level but
+// never raise it above what the CPU supports, and it cannot go below the
+// compile-time baseline.
+
+#define CHLM_KERNEL __attribute__((always_inline))
+
+namespace chlm {
+    /**
+     * @brief Instruction set levels that batch kernels can be dispatched to.
+     *
+     * Ordered from narrowest to widest within each architecture.
+     */
+    enum class simd_level : uint8_t
+    {
+        scalar,
+        sse2,
+        sse42,
+        avx2,
+        avx512,
+        neon
+    };
+
+    /**
+     * @brief Returns a human-readable name for a SIMD level.
+     *
+     * The returned names are the accepted values of the CHLM_SIMD_LEVEL override.
+     *
+     * @param level Level to name.
+     * @return Static string such as "avx2".
+     */
+    [[nodiscard]] constexpr std::string_view simd_level_name(const simd_level level) noexcept
+    {
+        switch (level)
+        {
+            case simd_level::sse2: return "sse2";
+            case simd_level::sse42: return "sse4.2";
+            case simd_level::avx2: return "avx2";
+            case simd_level::avx512: return "avx512";
+            case simd_level::neon: return "neon";
+            default: return "scalar";
+        }
+    }
+
+    /**
+     * @brief Probes the running CPU for the widest supported SIMD level.
+     *
+     * On x86 this queries cpuid through __builtin_cpu_supports. AVX2 is only
+     * reported together with FMA, and AVX-512 requires the F, VL, DQ and BW subsets.
+     *
+     * @return Widest level supported by the hardware.
+     */
+    [[nodiscard]] inline simd_level detect_simd_level() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") &&
+            __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512bw"))
+            return simd_level::avx512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return simd_level::avx2;
+        if (__builtin_cpu_supports("sse4.2"))
+            return simd_level::sse42;
+        return simd_level::sse2;
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+        return simd_level::neon;
+#else
+        return simd_level::scalar;
+#endif
+    }
+
+    namespace detail {
+        /**
+         * @brief Parses a CHLM_SIMD_LEVEL value.
+         *
+         * @param name     Level name as returned by simd_level_name().
+         * @param fallback Value returned for unknown names.
+         */
+        [[nodiscard]] constexpr simd_level parse_simd_level(const std::string_view name,
+                                                            const simd_level fallback) noexcept
+        {
+            if (name == "scalar") return simd_level::scalar;
+            if (name == "sse2") return simd_level::sse2;
+            if (name == "sse4.2" || name == "sse42") return simd_level::sse42;
+            if (name == "avx2") return simd_level::avx2;
+            if (name == "avx512") return simd_level::avx512;
+            if (name == "neon") return simd_level::neon;
+            return fallback;
+        }
+
+        /**
+         * @brief Detects the hardware level and applies the CHLM_SIMD_LEVEL cap.
+         */
+        [[nodiscard]] inline simd_level select_simd_level() noexcept
+        {
+            const simd_level detected{ detect_simd_level() };
+            const char* env{ std::getenv("CHLM_SIMD_LEVEL") };
+            if (!env) return detected;
+
+            const simd_level requested{ parse_simd_level(env, detected) };
+
+            // NEON and the x86 levels are not comparable; only honor same-family caps
+            if ((requested == simd_level::neon) != (detected == simd_level::neon) &&
+                requested != simd_level::scalar)
+                return detected;
+
+            return min(requested, detected);
+        }
+    } // namespace detail
+
+    /**
+     * @brief Returns the SIMD level used by dispatched batch kernels.
+     *
+     * Detected once on first call (thread-safe) and cached for the lifetime of the process.
+     * Without CHLM_RUNTIME_DISPATCH this still reports the hardware level, but kernels
+     * run with the compile-time instruction set regardless.
+     *
+     * @return Active SIMD level.
+     */
+    [[nodiscard]] inline simd_level active_simd_level() noexcept
+    {
+        static const simd_level level{ detail::select_simd_level() };
+        return level;
+    }
+
+    namespace detail {
+#if defined(CHLM_RUNTIME_DISPATCH) && (defined(__x86_64__) || defined(__i386__))
+        template<typename Kernel>
+        __attribute__((target("sse4.2"))) void run_sse42(const Kernel& kernel) noexcept { kernel(); }
+
+        template<typename Kernel>
+        __attribute__((target("avx2,fma"))) void run_avx2(const Kernel& kernel) noexcept { kernel(); }
+
+        template<typename Kernel>
+        __attribute__((target("avx512f,avx512vl,avx512dq,avx512bw,avx2,fma")))
+        void run_avx512(const Kernel& kernel) noexcept { kernel(); }
+#endif
+
+        /**
+         * @brief Runs a batch kernel compiled for the active SIMD level.
+         *
+         * @p kernel must be a lambda marked CHLM_KERNEL so its body is inlined into
+         * (and therefore code-generated for) the selected target.
+         *
+         * @param kernel Kernel body to execute.
+         */
+        template<typename Kernel>
+        inline void dispatch(const Kernel& kernel) noexcept
+        {
+#if defined(CHLM_RUNTIME_DISPATCH) && (defined(__x86_64__) || defined(__i386__))
+            switch (active_simd_level())
+            {
+                case simd_level::avx512: run_avx512(kernel); return;
+                case simd_level::avx2: run_avx2(kernel); return;
+                case simd_level::sse42: run_sse42(kernel); return;
+                default: kernel(); return;
+            }
+#else
+            kernel();
+#endif
+        }
+    } // namespace detail
+} // namespace chlm
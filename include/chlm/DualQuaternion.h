@@ -0,0 +1,166 @@
+//
+// Created by Zack Shrout on 10/16/26.
+// Copyright (c) 2026 BunnySoft. All rights reserved.
+//
+
+#pragma once
+
+#include "Core.h"
+#include "Vector.h"
+#include "Quaternion.h"
+#include "Matrix4x4.h"
+#include "MathConversions.h"
+
+namespace chlm {
+    // ========================================
+    // Dual quaternion - rigid transform (rotation + translation)
+    // real: rotation, dual: 0.5 * translation * rotation
+    // ========================================
+
+    /**
+     * @brief Unit dual quaternion representing a rigid transformation.
+     *
+     * Default-constructed value is the identity transform. Scale cannot be represented;
+     * use float3x4 / float4x4 for scaled joints.
+     */
+    struct dual_quat
+    {
+        quat real{ 0.f, 0.f, 0.f, 1.f };
+        quat dual{ 0.f, 0.f, 0.f, 0.f };
+    };
+
+    /**
+     * @brief Creates a dual quaternion that rotates and then translates.
+     *
+     * @param rotation    Unit rotation quaternion.
+     * @param translation Translation applied after the rotation.
+     * @return Dual quaternion with transform_point(dq, p) = rotate_vector(rotation, p) + translation.
+     */
+    [[nodiscard]] inline dual_quat make_dual_quat(const quat& rotation, const float3 translation) noexcept
+    {
+        const quat t{ translation.x, translation.y, translation.z, 0.f };
+        return dual_quat{ rotation, mul(t, rotation) * .5f };
+    }
+
+    /**
+     * @brief Creates a dual quaternion from a rigid 4x4 transform.
+     *
+     * The upper 3x3 part must be a pure rotation (orthonormal, det = 1); any scale or
+     * shear is not representable and yields an undefined rotation.
+     *
+     * @param m Rotation + translation matrix.
+     * @return Equivalent unit dual quaternion.
+     */
+    [[nodiscard]] inline dual_quat dual_quat_from_float4x4(const float4x4& m) noexcept
+    {
+        const quat rotation{ quat_from_float3x3(float3x3{ m[0].xyz, m[1].xyz, m[2].xyz }) };
+        return make_dual_quat(rotation, m[3].xyz);
+    }
+
+    /**
+     * @brief Returns the translation of a unit dual quaternion (2 * dual * conjugate(real)).
+     *
+     * @param dq Unit dual quaternion.
+     * @return Translation part.
+     */
+    [[nodiscard]] inline float3 dual_quat_translation(const dual_quat& dq) noexcept
+    {
+        const float3 r{ dq.real.xyz };
+        const float3 d{ dq.dual.xyz };
+        return 2.f * (dq.real.w * d - dq.dual.w * r + cross(r, d));
+    }
+
+    /**
+     * @brief Converts a unit dual quaternion to a 4x4 rigid transform.
+     *
+     * @param dq Unit dual quaternion.
+     * @return Rotation + translation matrix.
+     */
+    [[nodiscard]] inline float4x4 to_float4x4(const dual_quat& dq) noexcept
+    {
+        float4x4 m{ to_float4x4(dq.real) };
+        const float3 t{ dual_quat_translation(dq) };
+        m.columns[3] = float4{ t.x, t.y, t.z, 1.f };
+        return m;
+    }
+
+    /**
+     * @brief Composes two rigid transforms.
+     *
+     * Same order as mul(quat, quat) and mul(float4x4, float4x4): the result applies @p b
+     * first and then @p a:
+     * transform_point(mul(a, b), p) == transform_point(a, transform_point(b, p)).
+     *
+     * @param a Outer transform.
+     * @param b Inner transform.
+     * @return Composed dual quaternion.
+     */
+    [[nodiscard]] inline dual_quat mul(const dual_quat& a, const dual_quat& b) noexcept
+    {
+        return dual_quat{ mul(a.real, b.real), mul(a.real, b.dual) + mul(a.dual, b.real) };
+    }
+
+    /**
+     * @brief Normalizes a dual quaternion to a unit rigid transform.
+     *
+     * Divides both parts by the length of the real part and removes the component of the
+     * dual part along the real part, so blended values are valid rigid transforms again.
+     * Returns identity for a zero real part.
+     *
+     * @param dq Dual quaternion to normalize.
+     * @return Unit dual quaternion.
+     */
+    [[nodiscard]] inline dual_quat normalize(const dual_quat& dq) noexcept
+    {
+        const float len_sq{ dot(dq.real, dq.real) };
+        if (almost_equal(len_sq, 0.f)) return dual_quat{ };
+
+        const float inv_len{ 1.f / sqrt(len_sq) };
+        const quat real{ dq.real * inv_len };
+        const quat dual{ dq.dual * inv_len };
+        return dual_quat{ real, dual - real * dot(real, dual) };
+    }
+
+    /**
+     * @brief Blends two rigid transforms (dual quaternion linear blending).
+     *
+     * Takes the shortest path by flipping @p b when the rotations lie in opposite
+     * hemispheres, then normalizes. Unlike blending matrices, the result never shrinks
+     * or shears (no "candy wrapper" artifact).
+     *
+     * @param a Start transform.
+     * @param b End transform.
+     * @param t Blend factor (0 = a, 1 = b).
+     * @return Normalized blended transform.
+     */
+    [[nodiscard]] inline dual_quat blend(const dual_quat& a, const dual_quat& b, const float t) noexcept
+    {
+        const float wb{ dot(a.real, b.real) < 0.f ? -t : t };
+        const float wa{ 1.f - t };
+        return normalize(dual_quat{ a.real * wa + b.real * wb, a.dual * wa + b.dual * wb });
+    }
+
+    /**
+     * @brief Transforms a point by a unit dual quaternion (rotation, then translation).
+     *
+     * @param dq Unit dual quaternion.
+     * @param p  Point to transform.
+     * @return Transformed point.
+     */
+    [[nodiscard]] inline float3 transform_point(const dual_quat& dq, const float3 p) noexcept
+    {
+        return rotate_vector(dq.real, p) + dual_quat_translation(dq);
+    }
+
+    /**
+     * @brief Transforms a direction by a unit dual quaternion (translation ignored).
+     *
+     * @param dq Unit dual quaternion.
+     * @param v  Direction to transform.
+     * @return Rotated direction.
+     */
+    [[nodiscard]] inline float3 transform_vector(const dual_quat& dq, const float3 v) noexcept
+    {
+        return rotate_vector(dq.real, v);
+    }
+} // namespace chlm
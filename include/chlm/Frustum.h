@@ -0,0 +1,303 @@
+//
+// Created by Zack Shrout on 10/16/26.
+// Copyright (c) 2026 BunnySoft. All rights reserved.
+//
+
+#pragma once
+
+#include "Core.h"
+#include "Dispatch.h"
+#include "Vector.h"
+#include "Matrix4x4.h"
+#include "Aabb.h"
+#include "SoA.h"
+
+#include <span>
+
+namespace chlm {
+    // ========================================
+    // Frustum
+    // ========================================
+
+    /**
+     * @brief View frustum as six inward-facing planes.
+     *
+     * Each plane is stored as {normal.x, normal.y, normal.z, d} with a unit normal, so
+     * dot(normal, p) + d is the signed distance of p (positive inside), matching
+     * distance_point_plane(). Order: left, right, bottom, top, near, far.
+     */
+    struct frustum
+    {
+        float4 planes[6]{ };
+    };
+
+    /**
+     * @brief Clip-space depth range of a projection matrix.
+     *
+     * float4x4::ortho_rh() maps depth to [-1, 1] (OpenGL style); every other float4x4
+     * projection builder maps it to [0, 1].
+     */
+    enum class clip_depth : uint8_t
+    {
+        zero_to_one,
+        minus_one_to_one
+    };
+
+    /**
+     * @brief Extracts the frustum planes from a view-projection matrix (Gribb-Hartmann).
+     *
+     * For [0, 1] depth the near plane is the third row alone; for [-1, 1] depth it is
+     * row3 + row2. Pass clip_depth::minus_one_to_one for matrices built on
+     * float4x4::ortho_rh(). Passing a projection matrix alone yields view-space planes;
+     * view-projection yields world-space planes, and view-projection * model yields
+     * object-space planes.
+     *
+     * @param view_proj Column-major clip transform.
+     * @param depth     Depth range the projection maps to.
+     * @return Frustum with normalized planes.
+     */
+    inline frustum extract_frustum(const float4x4& view_proj,
+                                   const clip_depth depth = clip_depth::zero_to_one) noexcept
+    {
+        // Rows of the column-major matrix
+        float4 r0{ view_proj.columns[0] };
+        float4 r1{ view_proj.columns[1] };
+        float4 r2{ view_proj.columns[2] };
+        float4 r3{ view_proj.columns[3] };
+        detail::transpose4(r0, r1, r2, r3);
+
+        frustum f{ {
+            r3 + r0, // left:   -w <= x
+            r3 - r0, // right:   x <= w
+            r3 + r1, // bottom: -w <= y
+            r3 - r1, // top:     y <= w
+            depth == clip_depth::zero_to_one ? r2 : r3 + r2, // near: 0 <= z (or -w <= z)
+            r3 - r2  // far:     z <= w
+        } };
+
+        for (float4& plane : f.planes)
+            plane /= length(plane.xyz);
+
+        return f;
+    }
+
+    /**
+     * @brief Returns whether a bounding sphere is at least partially inside the frustum.
+     *
+     * @param f      Frustum to test against.
+     * @param center Sphere center.
+     * @param radius Sphere radius.
+     * @return false only if the sphere is entirely outside one of the planes.
+     */
+    inline bool intersects(const frustum& f, const float3 center, const float radius) noexcept
+    {
+        for (const float4 plane : f.planes)
+        {
+            if (dot(plane.xyz, center) + plane.w < -radius)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Returns whether an axis-aligned box is at least partially inside the frustum.
+     *
+     * Conservative: boxes near a frustum corner that are outside but not separated by a
+     * single plane are reported as visible.
+     *
+     * @param f        Frustum to test against.
+     * @param box_min  Minimum corner.
+     * @param box_max  Maximum corner.
+     * @return false only if the box is entirely outside one of the planes.
+     */
+    inline bool intersects(const frustum& f, const float3 box_min, const float3 box_max) noexcept
+    {
+        const float3 center{ (box_min + box_max) * .5f };
+        const float3 extents{ (box_max - box_min) * .5f };
+
+        for (const float4 plane : f.planes)
+        {
+            // Projected radius of the box onto the plane normal
+            const float r{ dot(abs(plane.xyz), extents) };
+            if (dot(plane.xyz, center) + plane.w < -r)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Returns whether a bounding box is at least partially inside the frustum.
+     *
+     * @param f   Frustum to test against.
+     * @param box Box to test.
+     * @return false only if the box is empty or entirely outside one of the planes.
+     */
+    inline bool intersects(const frustum& f, const aabb3& box) noexcept
+    {
+        return !empty(box) && intersects(f, box.min.xyz, box.max.xyz);
+    }
+
+    // ========================================
+    // Batch culling (SoA)
+    // ========================================
+    // Results are a bitmask: bit (i % 32) of visible[i / 32] is set when object i
+    // intersects the frustum. Eight objects are tested per iteration with each plane
+    // broadcast across a float8, so the output needs (count + 31) / 32 words.
+
+    namespace detail {
+        /**
+         * @brief Runs an 8-wide test over [0, count) and packs the results into 32-bit words.
+         *
+         * @param test8 Callable returning an int8 lane mask for objects [i, i + 8).
+         * @param test1 Callable returning a bool for object i.
+         */
+        template<typename Test8, typename Test1>
+        inline void cull_bits(const size_t count, const std::span<uint32_t> visible,
+                              const Test8& test8, const Test1& test1) noexcept
+        {
+            const size_t words{ (count + 31) / 32 };
+            assert(visible.size() >= words);
+
+            dispatch([&]() CHLM_KERNEL
+            {
+                for (size_t w{ 0 }; w < words; ++w)
+                {
+                    const size_t base{ w * 32 };
+                    const size_t n{ min<size_t>(count - base, 32) };
+
+                    uint32_t bits{ 0 };
+                    size_t j{ 0 };
+                    for (; j + 8 <= n; j += 8)
+                        bits |= movemask(test8(base + j)) << j;
+                    for (; j < n; ++j)
+                        bits |= static_cast<uint32_t>(test1(base + j)) << j;
+
+                    visible[w] = bits;
+                }
+            });
+        }
+    } // namespace detail
+
+    /**
+     * @brief Culls bounding spheres stored as separate arrays.
+     *
+     * @param f       Frustum to test against.
+     * @param xs      Sphere center X coordinates.
+     * @param ys      Sphere center Y coordinates (at least xs.size() elements).
+     * @param zs      Sphere center Z coordinates (at least xs.size() elements).
+     * @param radii   Sphere radii (at least xs.size() elements).
+     * @param visible Output bitmask, at least (xs.size() + 31) / 32 words.
+     */
+    inline void cull_spheres(const frustum& f,
+                             const std::span<const float> xs, const std::span<const float> ys,
+                             const std::span<const float> zs, const std::span<const float> radii,
+                             const std::span<uint32_t> visible) noexcept
+    {
+        const size_t count{ xs.size() };
+        assert(ys.size() >= count && zs.size() >= count && radii.size() >= count);
+
+        detail::cull_bits(count, visible,
+            [&](const size_t i) CHLM_KERNEL
+            {
+                const float8 x{ detail::load<float8>(xs.data() + i) };
+                const float8 y{ detail::load<float8>(ys.data() + i) };
+                const float8 z{ detail::load<float8>(zs.data() + i) };
+                const float8 neg_r{ -detail::load<float8>(radii.data() + i) };
+
+                int8 inside{ ~int8{ } };
+                for (const float4 plane : f.planes)
+                    inside &= x * plane.x + y * plane.y + z * plane.z + plane.w >= neg_r;
+                return inside;
+            },
+            [&](const size_t i) CHLM_KERNEL
+            {
+                return intersects(f, float3{ xs[i], ys[i], zs[i] }, radii[i]);
+            });
+    }
+
+    /**
+     * @brief Culls bounding spheres stored in a float4_soa (xyz = center, w = radius).
+     *
+     * @param f       Frustum to test against.
+     * @param spheres Sphere centers and radii.
+     * @param visible Output bitmask, at least (spheres.size() + 31) / 32 words.
+     */
+    inline void cull_spheres(const frustum& f, const float4_soa& spheres, const std::span<uint32_t> visible) noexcept
+    {
+        cull_spheres(f, spheres.x(), spheres.y(), spheres.z(), spheres.w(), visible);
+    }
+
+    /**
+     * @brief Culls axis-aligned boxes stored as separate min/max arrays.
+     *
+     * Each box is tested in center/extent form: it is outside a plane when
+     * dot(n, center) + d < dot(|n|, extents).
+     *
+     * @param f       Frustum to test against.
+     * @param min_xs  Box minimum X coordinates.
+     * @param min_ys  Box minimum Y coordinates.
+     * @param min_zs  Box minimum Z coordinates.
+     * @param max_xs  Box maximum X coordinates.
+     * @param max_ys  Box maximum Y coordinates.
+     * @param max_zs  Box maximum Z coordinates.
+     * @param visible Output bitmask, at least (min_xs.size() + 31) / 32 words.
+     */
+    inline void cull_aabbs(const frustum& f,
+                           const std::span<const float> min_xs, const std::span<const float> min_ys,
+                           const std::span<const float> min_zs,
+                           const std::span<const float> max_xs, const std::span<const float> max_ys,
+                           const std::span<const float> max_zs,
+                           const std::span<uint32_t> visible) noexcept
+    {
+        const size_t count{ min_xs.size() };
+        assert(min_ys.size() >= count && min_zs.size() >= count);
+        assert(max_xs.size() >= count && max_ys.size() >= count && max_zs.size() >= count);
+
+        detail::cull_bits(count, visible,
+            [&](const size_t i) CHLM_KERNEL
+            {
+                const float8 lo_x{ detail::load<float8>(min_xs.data() + i) };
+                const float8 lo_y{ detail::load<float8>(min_ys.data() + i) };
+                const float8 lo_z{ detail::load<float8>(min_zs.data() + i) };
+                const float8 hi_x{ detail::load<float8>(max_xs.data() + i) };
+                const float8 hi_y{ detail::load<float8>(max_ys.data() + i) };
+                const float8 hi_z{ detail::load<float8>(max_zs.data() + i) };
+
+                const float8 cx{ (lo_x + hi_x) * .5f };
+                const float8 cy{ (lo_y + hi_y) * .5f };
+                const float8 cz{ (lo_z + hi_z) * .5f };
+                const float8 ex{ (hi_x - lo_x) * .5f };
+                const float8 ey{ (hi_y - lo_y) * .5f };
+                const float8 ez{ (hi_z - lo_z) * .5f };
+
+                int8 inside{ ~int8{ } };
+                for (const float4 plane : f.planes)
+                {
+                    const float4 n{ abs(plane) };
+                    const float8 r{ ex * n.x + ey * n.y + ez * n.z };
+                    inside &= cx * plane.x + cy * plane.y + cz * plane.z + plane.w >= -r;
+                }
+                return inside;
+            },
+            [&](const size_t i) CHLM_KERNEL
+            {
+                return intersects(f, float3{ min_xs[i], min_ys[i], min_zs[i] },
+                                  float3{ max_xs[i], max_ys[i], max_zs[i] });
+            });
+    }
+
+    /**
+     * @brief Culls axis-aligned boxes stored as two float3_soa (minimum and maximum corners).
+     *
+     * @param f       Frustum to test against.
+     * @param mins    Box minimum corners.
+     * @param maxs    Box maximum corners (same size as @p mins).
+     * @param visible Output bitmask, at least (mins.size() + 31) / 32 words.
+     */
+    inline void cull_aabbs(const frustum& f, const float3_soa& mins, const float3_soa& maxs,
+                           const std::span<uint32_t> visible) noexcept
+    {
+        assert(maxs.size() == mins.size());
+        cull_aabbs(f, mins.x(), mins.y(), mins.z(), maxs.x(), maxs.y(), maxs.z(), visible);
+    }
+} // namespace chlm
@@ -6,18 +6,21 @@
 #pragma once
 
 #include "Core.h"
+#include "Dispatch.h"
+#include "Vector.h"
 #include "Quaternion.h"
 #include "Matrix4x4.h"
 #include "Matrix3x3.h"
 
 #include <future>
+#include <span>
 
 namespace chlm {
     /**
      * @brief Converts a unit quaternion to a 4x4 rotation matrix.
      *
-     * The resulting matrix contains only rotation (no translation or scale).
-     * The bottom row is always {0, 0, 0, 1}.
+     * The resulting matrix contains only rotation (no translation or scale) and rotates
+     * vectors exactly like rotate_vector(q, v). The bottom row is always {0, 0, 0, 1}.
      *
      * @param q Unit quaternion (assumed normalized).
      * @return 4x4 homogeneous rotation matrix.
@@ -35,9 +38,9 @@ namespace chlm {
         const float wz{ q.w * q.z };
 
         return float4x4{
-            float4{ 1.f - 2.f * (yy + zz), 2.f * (xy - wz), 2.f * (xz + wy), 0.f },
-            float4{ 2.f * (xy + wz), 1.f - 2.f * (xx + zz), 2.f * (yz - wx), 0.f },
-            float4{ 2.f * (xz - wy), 2.f * (yz + wx), 1.f - 2.f * (xx + yy), 0.f },
+            float4{ 1.f - 2.f * (yy + zz), 2.f * (xy + wz), 2.f * (xz - wy), 0.f },
+            float4{ 2.f * (xy - wz), 1.f - 2.f * (xx + zz), 2.f * (yz + wx), 0.f },
+            float4{ 2.f * (xz + wy), 2.f * (yz - wx), 1.f - 2.f * (xx + yy), 0.f },
             float4{ 0.f, 0.f, 0.f, 1.f }
         };
     }
@@ -63,9 +66,9 @@ namespace chlm {
         const float wz{ q.w * q.z };
 
         return float3x3{
-            float3{ 1.f - 2.f * (yy + zz), 2.f * (xy - wz), 2.f * (xz + wy) },
-            float3{ 2.f * (xy + wz), 1.f - 2.f * (xx + zz), 2.f * (yz - wx) },
-            float3{ 2.f * (xz - wy), 2.f * (yz + wx), 1.f - 2.f * (xx + yy) }
+            float3{ 1.f - 2.f * (yy + zz), 2.f * (xy + wz), 2.f * (xz - wy) },
+            float3{ 2.f * (xy - wz), 1.f - 2.f * (xx + zz), 2.f * (yz + wx) },
+            float3{ 2.f * (xz + wy), 2.f * (yz - wx), 1.f - 2.f * (xx + yy) }
         };
     }
 
@@ -87,14 +90,14 @@ namespace chlm {
         {
             const float s{ sqrt(trace + 1.0f) * 2.0f };
             q.w = .25f * s;
-            q.x = (m[2].y - m[1].z) / s;
-            q.y = (m[0].z - m[2].x) / s;
-            q.z = (m[1].x - m[0].y) / s;
+            q.x = (m[1].z - m[2].y) / s;
+            q.y = (m[2].x - m[0].z) / s;
+            q.z = (m[0].y - m[1].x) / s;
         }
         else if (m[0].x > m[1].y && m[0].x > m[2].z)
         {
             const float s{ sqrt(1.f + m[0].x - m[1].y - m[2].z) * 2.f };
-            q.w = (m[2].y - m[1].z) / s;
+            q.w = (m[1].z - m[2].y) / s;
             q.x = .25f * s;
             q.y = (m[0].y + m[1].x) / s;
             q.z = (m[0].z + m[2].x) / s;
@@ -102,7 +105,7 @@ namespace chlm {
         else if (m[1].y > m[2].z)
         {
             const float s{ sqrt(1.f + m[1].y - m[0].x - m[2].z) * 2.f };
-            q.w = (m[0].z - m[2].x) / s;
+            q.w = (m[2].x - m[0].z) / s;
             q.x = (m[0].y + m[1].x) / s;
             q.y = .25f * s;
             q.z = (m[1].z + m[2].y) / s;
@@ -110,7 +113,7 @@ namespace chlm {
         else
         {
             const float s{ sqrt(1.f + m[2].z - m[0].x - m[1].y) * 2.f };
-            q.w = (m[1].x - m[0].y) / s;
+            q.w = (m[0].y - m[1].x) / s;
             q.x = (m[0].z + m[2].x) / s;
             q.y = (m[1].z + m[2].y) / s;
             q.z = .25f * s;
@@ -136,16 +139,15 @@ namespace chlm {
     }
 
     /**
-     * @brief Fast inverse for affine transformation matrices.
+     * @brief Fast inverse for rigid affine transformation matrices.
      *
-     * Assumes the matrix is composed of rotation (or rotation + uniform scale),
-     * translation, and no shear or projection - typical for object/model matrices.
-     * Much faster than general inverse.
+     * Assumes the upper 3x3 part is a pure rotation (orthonormal, no scale or shear),
+     * so its inverse is a transpose. Use affine_inverse() for scaled matrices.
      *
-     * @param m Affine transformation matrix.
-     * @return Inverse matrix such that m * affine_inverse(m) ≈ identity.
+     * @param m Rigid affine transformation matrix.
+     * @return Inverse matrix such that m * affine_inverse_orthonormal(m) ≈ identity.
      */
-    inline float4x4 affine_inverse(const float4x4& m) noexcept
+    inline float4x4 affine_inverse_orthonormal(const float4x4& m) noexcept
     {
         const float3x3 rot{
             m.columns[0].xyz,
@@ -166,16 +168,63 @@ namespace chlm {
         };
     }
 
+    /**
+     * @brief Fast inverse for affine transformation matrices.
+     *
+     * Handles any invertible upper 3x3 part (rotation, uniform or non-uniform scale,
+     * shear) via the cross-product 3x3 inverse; the translation becomes -A⁻¹t. The
+     * bottom row is assumed to be {0, 0, 0, 1}. Much faster than the general inverse().
+     *
+     * @param m Affine transformation matrix.
+     * @return Inverse matrix such that m * affine_inverse(m) ≈ identity.
+     *         Returns identity if the 3x3 part is singular or non-finite
+     *         (|det| <= epsilon * |c0| |c1| |c2|, relative to the column lengths).
+     */
+    inline float4x4 affine_inverse(const float4x4& m) noexcept
+    {
+        const float3x3 linear{
+            m.columns[0].xyz,
+            m.columns[1].xyz,
+            m.columns[2].xyz
+        };
+
+        // Scale-relative singularity test (Hadamard bound); also rejects inf and NaN
+        const float3x3 cof{ cofactor(linear) };
+        const float det{ dot(linear[0], cof[0]) };
+        if (!(abs(det) > epsilon * length(linear[0]) * length(linear[1]) * length(linear[2])))
+            return float4x4::identity();
+
+        // Rows of the 3x3 inverse are the cofactor columns / det; transpose into columns
+        const float inv_det{ 1.f / det };
+        float4 c0{ cof[0].x, cof[0].y, cof[0].z, 0.f };
+        float4 c1{ cof[1].x, cof[1].y, cof[1].z, 0.f };
+        float4 c2{ cof[2].x, cof[2].y, cof[2].z, 0.f };
+        float4 c3{ float4_zero };
+        detail::transpose4(c0, c1, c2, c3);
+        c0 *= inv_det;
+        c1 *= inv_det;
+        c2 *= inv_det;
+
+        const float4 t{ m.columns[3] };
+        float4 inv_t{ -(t.x * c0 + t.y * c1 + t.z * c2) };
+        inv_t.w = 1.f;
+
+        return float4x4{ c0, c1, c2, inv_t };
+    }
+
     /**
      * @brief Computes the normal matrix from a 4x4 transformation.
      *
-     * The normal matrix is the inverse transpose of the upper 3x3 part.
-     * Used to correctly transform surface normals when non-uniform scaling is present.
+     * The normal matrix is the inverse transpose of the upper 3x3 part, which is its
+     * cofactor matrix divided by the determinant. Correctly transforms surface normals
+     * under non-uniform scale and shear.
      *
      * @param m Transformation matrix (model matrix).
      * @return 3x3 matrix for transforming normals.
+     *         Returns identity if the 3x3 part is singular or non-finite
+     *         (|det| <= epsilon * |c0| |c1| |c2|, relative to the column lengths).
      */
-    constexpr float3x3 normal_matrix(const float4x4& m) noexcept
+    inline float3x3 normal_matrix(const float4x4& m) noexcept
     {
         const float3x3 upper{
             m.columns[0].xyz,
@@ -183,27 +232,29 @@ namespace chlm {
             m.columns[2].xyz
         };
 
-        return inverse_orthonormal(upper);
+        // Scale-relative singularity test (Hadamard bound); also rejects inf and NaN
+        const float3x3 cof{ cofactor(upper) };
+        const float det{ dot(upper[0], cof[0]) };
+        if (!(abs(det) > epsilon * length(upper[0]) * length(upper[1]) * length(upper[2])))
+            return float3x3::identity();
+
+        const float inv_det{ 1.f / det };
+        return float3x3{ cof[0] * inv_det, cof[1] * inv_det, cof[2] * inv_det };
     }
 
     /**
-     * @brief Computes the general inverse of a 4x4 matrix.
+     * @brief Computes the general inverse of a 4x4 matrix with Gauss-Jordan elimination.
      *
-     * Uses Gauss-Jordan elimination with partial pivoting for numerical stability.
-     * This is a full inverse that works for any invertible 4x4 matrix (including
-     * those with projection, shear, or non-uniform scaling).
-     *
-     * @note This is significantly slower than affine_inverse() or assuming an
-     *       orthonormal basis. Use only when a full inverse is required
-     *       (e.g. for view-projection matrices or arbitrary transformations).
-     *       For model matrices, prefer affine_inverse().
+     * Uses partial pivoting for numerical stability, so it degrades more gracefully
+     * than inverse() on ill-conditioned matrices (near-singular or with widely varying
+     * magnitudes). Scalar and branchy; prefer inverse() unless accuracy problems show up.
      *
      * @param m The matrix to invert. Must be invertible.
-     * @return The inverse matrix such that m * inverse(m) ≈ identity.
-     *         If the matrix is singular (determinant ≈ 0), returns the identity
+     * @return The inverse matrix such that m * inverse_precise(m) ≈ identity.
+     *         If the matrix is singular (a pivot < epsilon), returns the identity
      *         matrix as a safe fallback.
      */
-    constexpr float4x4 inverse(const float4x4& m) noexcept
+    constexpr float4x4 inverse_precise(const float4x4& m) noexcept
     {
         // Copy matrix into flat scalar array (column-major -> row-major transpose for row ops)
         float a[4][4];
@@ -276,4 +327,247 @@ namespace chlm {
             float4{ inv[0][3], inv[1][3], inv[2][3], inv[3][3] }
         };
     }
+
+    // ========================================
+    // Cofactor inverse / determinant (SIMD)
+    // ========================================
+    // The matrix is split into four 2x2 blocks, each held in one float4 as
+    // {m00, m01, m10, m11}:
+    //
+    //     | A  B |
+    //     | C  D |
+    //
+    // The inverse is assembled from the blocks' adjugates (A# etc.) and determinants,
+    // so everything stays in registers as shuffles and multiply-adds. Since
+    // inverse(transpose(M)) = transpose(inverse(M)), feeding the columns in as rows
+    // produces the columns of the result directly.
+
+    namespace detail {
+        /** @brief 2x2 block product A * B. */
+        inline float4 mat2_mul(const float4 a, const float4 b) noexcept
+        {
+            return a * b.xwxw + a.yxwz * b.zyzy;
+        }
+
+        /** @brief 2x2 block product adj(A) * B. */
+        inline float4 mat2_adj_mul(const float4 a, const float4 b) noexcept
+        {
+            return a.wwxx * b - a.yyzz * b.zwxy;
+        }
+
+        /** @brief 2x2 block product A * adj(B). */
+        inline float4 mat2_mul_adj(const float4 a, const float4 b) noexcept
+        {
+            return a * b.wxwx - a.yxwz * b.zyzy;
+        }
+
+        /** @brief Determinants of the four 2x2 blocks as {|A|, |B|, |C|, |D|}. */
+        inline float4 block_determinants(const float4x4& m) noexcept
+        {
+            return __builtin_shufflevector(m[0], m[2], 0, 2, 4, 6) * __builtin_shufflevector(m[1], m[3], 1, 3, 5, 7) -
+                   __builtin_shufflevector(m[0], m[2], 1, 3, 5, 7) * __builtin_shufflevector(m[1], m[3], 0, 2, 4, 6);
+        }
+    } // namespace detail
+
+    /**
+     * @brief Computes the determinant of a 4x4 matrix.
+     *
+     * @param m Input matrix.
+     * @return det(m).
+     */
+    inline float determinant(const float4x4& m) noexcept
+    {
+        const float4 a{ __builtin_shufflevector(m[0], m[1], 0, 1, 4, 5) };
+        const float4 b{ __builtin_shufflevector(m[0], m[1], 2, 3, 6, 7) };
+        const float4 c{ __builtin_shufflevector(m[2], m[3], 0, 1, 4, 5) };
+        const float4 d{ __builtin_shufflevector(m[2], m[3], 2, 3, 6, 7) };
+
+        const float4 dets{ detail::block_determinants(m) };
+        const float4 a_b{ detail::mat2_adj_mul(a, b) };
+        const float4 d_c{ detail::mat2_adj_mul(d, c) };
+
+        // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+        return dets.x * dets.w + dets.y * dets.z - hsum(a_b * d_c.xzyw);
+    }
+
+    /**
+     * @brief Computes the general inverse of a 4x4 matrix.
+     *
+     * Vectorized cofactor (adjugate / determinant) inverse using 2x2 block
+     * decomposition. Works for any invertible matrix, including projections, shear
+     * and non-uniform scale. Without pivoting it loses precision sooner than
+     * inverse_precise() on ill-conditioned input.
+     *
+     * @note For model matrices prefer affine_inverse(), which is cheaper still. Not
+     *       constexpr; use inverse_precise() in constant expressions.
+     *
+     * @param m The matrix to invert. Must be invertible.
+     * @return The inverse matrix such that m * inverse(m) ≈ identity.
+     *         Returns identity if the matrix is singular or non-finite
+     *         (|det| <= epsilon * |c0| |c1| |c2| |c3|, relative to the column lengths).
+     */
+    inline float4x4 inverse(const float4x4& m) noexcept
+    {
+        const float4 a{ __builtin_shufflevector(m[0], m[1], 0, 1, 4, 5) };
+        const float4 b{ __builtin_shufflevector(m[0], m[1], 2, 3, 6, 7) };
+        const float4 c{ __builtin_shufflevector(m[2], m[3], 0, 1, 4, 5) };
+        const float4 d{ __builtin_shufflevector(m[2], m[3], 2, 3, 6, 7) };
+
+        const float4 dets{ detail::block_determinants(m) };
+        const float4 det_a{ dets.xxxx };
+        const float4 det_b{ dets.yyyy };
+        const float4 det_c{ dets.zzzz };
+        const float4 det_d{ dets.wwww };
+
+        const float4 a_b{ detail::mat2_adj_mul(a, b) };
+        const float4 d_c{ detail::mat2_adj_mul(d, c) };
+
+        // |det| <= |c0| |c1| |c2| |c3| (Hadamard), so this singularity test is independent
+        // of the overall scale; it also rejects zero, inf and NaN determinants
+        const float det{ dets.x * dets.w + dets.y * dets.z - hsum(a_b * d_c.xzyw) };
+        if (!(abs(det) > epsilon * length(m[0]) * length(m[1]) * length(m[2]) * length(m[3])))
+            return float4x4::identity();
+
+        // Adjugates of the result blocks, scaled by ±1/|M|
+        const float4 scale{ float4{ 1.f, -1.f, -1.f, 1.f } / det };
+        const float4 x{ (det_d * a - detail::mat2_mul(b, d_c)) * scale };
+        const float4 y{ (det_b * c - detail::mat2_mul_adj(d, a_b)) * scale };
+        const float4 z{ (det_c * b - detail::mat2_mul_adj(a, d_c)) * scale };
+        const float4 w{ (det_a * d - detail::mat2_mul(c, a_b)) * scale };
+
+        // Undo the adjugate and re-interleave the blocks into columns
+        return float4x4{
+            __builtin_shufflevector(x, y, 3, 1, 7, 5),
+            __builtin_shufflevector(x, y, 2, 0, 6, 4),
+            __builtin_shufflevector(z, w, 3, 1, 7, 5),
+            __builtin_shufflevector(z, w, 2, 0, 6, 4)
+        };
+    }
+
+    // ========================================
+    // TRS decomposition / composition
+    // ========================================
+
+    /**
+     * @brief Translation, rotation and scale of an affine transform (applied scale first).
+     *
+     * Default value is the identity transform.
+     */
+    struct trs
+    {
+        float3 translation{ 0.f, 0.f, 0.f };
+        quat rotation{ 0.f, 0.f, 0.f, 1.f };
+        float3 scale{ 1.f, 1.f, 1.f };
+    };
+
+    /**
+     * @brief Builds translate(t) * rotate(r) * scale(s) directly, without matrix products.
+     *
+     * Each rotation column comes straight from the quaternion terms (as in to_float4x4)
+     * and is multiplied by its scale factor.
+     *
+     * @param translation Translation.
+     * @param rotation    Unit rotation quaternion.
+     * @param scale       Per-axis scale (negative values mirror).
+     * @return Affine transformation matrix.
+     */
+    inline float4x4 compose_trs(const float3 translation, const quat& rotation, const float3 scale) noexcept
+    {
+        const float4 q2{ rotation * 2.f };
+        const float xx{ rotation.x * q2.x };
+        const float yy{ rotation.y * q2.y };
+        const float zz{ rotation.z * q2.z };
+        const float xy{ rotation.x * q2.y };
+        const float xz{ rotation.x * q2.z };
+        const float yz{ rotation.y * q2.z };
+        const float wx{ rotation.w * q2.x };
+        const float wy{ rotation.w * q2.y };
+        const float wz{ rotation.w * q2.z };
+
+        return float4x4{
+            float4{ 1.f - (yy + zz), xy + wz, xz - wy, 0.f } * scale.x,
+            float4{ xy - wz, 1.f - (xx + zz), yz + wx, 0.f } * scale.y,
+            float4{ xz + wy, yz - wx, 1.f - (xx + yy), 0.f } * scale.z,
+            float4{ translation.x, translation.y, translation.z, 1.f }
+        };
+    }
+
+    /**
+     * @brief Builds the matrix of a TRS transform.
+     *
+     * @param t Translation, rotation and scale.
+     * @return translate(t.translation) * rotate(t.rotation) * scale(t.scale).
+     */
+    inline float4x4 compose_trs(const trs& t) noexcept
+    {
+        return compose_trs(t.translation, t.rotation, t.scale);
+    }
+
+    /**
+     * @brief Splits an affine matrix into translation, rotation and scale.
+     *
+     * Scale is the length of each basis column. A mirroring matrix (negative determinant)
+     * is returned with a negative X scale, so compose_trs(decompose(m)) reproduces m.
+     * Shear and projection cannot be represented and are lost; if a column has zero
+     * length the rotation about the collapsed axis is arbitrary.
+     *
+     * @param m Affine transformation matrix.
+     * @return Translation, unit rotation and scale of @p m.
+     */
+    inline trs decompose(const float4x4& m) noexcept
+    {
+        const float3 c0{ m[0].xyz };
+        const float3 c1{ m[1].xyz };
+        const float3 c2{ m[2].xyz };
+
+        float3 scale{ length(c0), length(c1), length(c2) };
+        if (dot(c0, cross(c1, c2)) < 0.f)
+            scale.x = -scale.x;  // Mirrored: fold the reflection into X
+
+        // Zero scale leaves the column at zero rather than dividing by it
+        const float3 inv_scale{
+            almost_equal(scale.x, 0.f) ? 0.f : 1.f / scale.x,
+            almost_equal(scale.y, 0.f) ? 0.f : 1.f / scale.y,
+            almost_equal(scale.z, 0.f) ? 0.f : 1.f / scale.z
+        };
+
+        const quat rotation{ quat_from_float3x3(float3x3{ c0 * inv_scale.x, c1 * inv_scale.y, c2 * inv_scale.z }) };
+        return trs{ m[3].xyz, normalize(rotation), scale };
+    }
+
+    /**
+     * @brief Decomposes an array of matrices: out[i] = decompose(in[i]).
+     *
+     * @param in  Affine transformation matrices.
+     * @param out Destination (at least in.size() elements).
+     */
+    inline void decompose(const std::span<const float4x4> in, const std::span<trs> out) noexcept
+    {
+        assert(out.size() >= in.size());
+
+        const size_t count{ in.size() };
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            for (size_t i{ 0 }; i < count; ++i)
+                out[i] = decompose(in[i]);
+        });
+    }
+
+    /**
+     * @brief Composes an array of TRS transforms: out[i] = compose_trs(in[i]).
+     *
+     * @param in  Translation, rotation and scale per element.
+     * @param out Destination (at least in.size() elements).
+     */
+    inline void compose_trs(const std::span<const trs> in, const std::span<float4x4> out) noexcept
+    {
+        assert(out.size() >= in.size());
+
+        const size_t count{ in.size() };
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            for (size_t i{ 0 }; i < count; ++i)
+                out[i] = compose_trs(in[i]);
+        });
+    }
 } // namespace chlm
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "Core.h"
+#include "Vector.h"
 #include "Quaternion.h"
 
 namespace chlm {
@@ -140,6 +141,59 @@ namespace chlm {
         return transpose(m);
     }
 
+    // ========================================
+    // General inverse (any invertible matrix: scale, shear)
+    // ========================================
+
+    /**
+     * @brief Computes the determinant of a 3x3 matrix (scalar triple product of the columns).
+     *
+     * @param m Input matrix.
+     * @return det(m).
+     */
+    inline float determinant(const float3x3& m) noexcept
+    {
+        return dot(m[0], cross(m[1], m[2]));
+    }
+
+    /**
+     * @brief Computes the cofactor matrix (transpose of the adjugate) of a 3x3 matrix.
+     *
+     * Each column is the cross product of the other two columns, so cofactor(m) / det(m)
+     * is the inverse-transpose of m.
+     *
+     * @param m Input matrix.
+     * @return Cofactor matrix.
+     */
+    inline float3x3 cofactor(const float3x3& m) noexcept
+    {
+        return float3x3{ cross(m[1], m[2]), cross(m[2], m[0]), cross(m[0], m[1]) };
+    }
+
+    /**
+     * @brief Computes the inverse of an arbitrary 3x3 matrix.
+     *
+     * Three cross products, one dot and a transpose; valid for scale and shear,
+     * unlike inverse_orthonormal().
+     *
+     * @param m Input matrix.
+     * @return Inverse matrix such that m * inverse(m) ≈ identity.
+     *         Returns identity if the matrix is singular or non-finite
+     *         (|det| <= epsilon * |c0| |c1| |c2|, relative to the column lengths).
+     */
+    inline float3x3 inverse(const float3x3& m) noexcept
+    {
+        // |det| <= |c0| |c1| |c2| (Hadamard), so this singularity test is independent of
+        // the overall scale; it also rejects zero, inf and NaN determinants
+        const float3x3 cof{ cofactor(m) };
+        const float det{ dot(m[0], cof[0]) };
+        if (!(abs(det) > epsilon * length(m[0]) * length(m[1]) * length(m[2])))
+            return float3x3::identity();
+
+        const float inv_det{ 1.f / det };
+        return transpose(float3x3{ cof[0] * inv_det, cof[1] * inv_det, cof[2] * inv_det });
+    }
+
     // ========================================
     // Builders
     // ========================================
@@ -152,8 +206,8 @@ namespace chlm {
      */
     constexpr float3x3 rotate_x(const float rad) noexcept
     {
-        const float c{ cos(rad) };
-        const float s{ sin(rad) };
+        float s, c;
+        sincos(rad, s, c);
 
         return float3x3{
             float3{ 1.f, 0.f, 0.f },
@@ -170,8 +224,8 @@ namespace chlm {
      */
     constexpr float3x3 rotate_y(const float rad) noexcept
     {
-        const float c{ cos(rad) };
-        const float s{ sin(rad) };
+        float s, c;
+        sincos(rad, s, c);
 
         return float3x3{
             float3{ c, 0.f, -s },
@@ -188,8 +242,8 @@ namespace chlm {
      */
     constexpr float3x3 rotate_z(const float rad) noexcept
     {
-        const float c{ cos(rad) };
-        const float s{ sin(rad) };
+        float s, c;
+        sincos(rad, s, c);
 
         return float3x3{
             float3{ c, s, 0.f },
@@ -222,9 +276,9 @@ namespace chlm {
         const float wz{ q.w * q.z };
 
         return {
-            float3{ 1.f - 2.f * (yy + zz), 2.f * (xy - wz), 2.f * (xz + wy) },
-            float3{ 2.f * (xy + wz), 1.f - 2.f * (xx + zz), 2.f * (yz - wx) },
-            float3{ 2.f * (xz - wy), 2.f * (yz + wx), 1.f - 2.f * (xx + yy) }
+            float3{ 1.f - 2.f * (yy + zz), 2.f * (xy + wz), 2.f * (xz - wy) },
+            float3{ 2.f * (xy - wz), 1.f - 2.f * (xx + zz), 2.f * (yz + wx) },
+            float3{ 2.f * (xz + wy), 2.f * (yz - wx), 1.f - 2.f * (xx + yy) }
         };
     }
 } // namespace chlm
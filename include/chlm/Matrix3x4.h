@@ -0,0 +1,208 @@
+//
+// Created by Zack Shrout on 10/16/26.
+// Copyright (c) 2026 BunnySoft. All rights reserved.
+//
+
+#pragma once
+
+#include "Core.h"
+#include "Vector.h"
+#include "Matrix4x4.h"
+
+namespace chlm {
+    // ========================================
+    // float3x4 - Affine transform, 3 float4 rows
+    // ========================================
+    // Unlike float4x4 this type is stored row-major: each row holds the three
+    // linear coefficients plus the translation in w. The implicit fourth row is
+    // always {0, 0, 0, 1}, so it is neither stored nor multiplied, saving 25% memory
+    // and about a third of the multiplies when composing. Semantics are the same as
+    // float4x4 (column vectors, mul(a, b) applies b first).
+
+    struct float3x4
+    {
+        float4 rows[3]{
+            float4{ 1.f, 0.f, 0.f, 0.f },
+            float4{ 0.f, 1.f, 0.f, 0.f },
+            float4{ 0.f, 0.f, 1.f, 0.f }
+        }; // default is identity
+
+        /**
+         * @brief Accesses a row of the matrix for reading or writing.
+         *
+         * @param i Row index (0-2). xyz hold the linear part, w holds the translation.
+         * @return Reference to the specified row.
+         *
+         * @note Index must be 0–2. Asserts in debug builds on out-of-bounds access.
+         */
+        float4& operator[](const int i)
+        {
+            assert(i >= 0 && i < 3);
+            return rows[i];
+        }
+
+        /**
+         * @brief Accesses a row of the matrix for reading (const version).
+         *
+         * @param i Row index (0–2).
+         * @return Const reference to the specified row.
+         */
+        const float4& operator[](const int i) const
+        {
+            assert(i >= 0 && i < 3);
+            return rows[i];
+        }
+
+        /**
+         * @brief Returns the identity transform.
+         *
+         * @return 3x4 identity matrix.
+         */
+        static constexpr float3x4 identity() noexcept { return { }; }
+    };
+
+    // ========================================
+    // Conversions
+    // ========================================
+
+    /**
+     * @brief Converts an affine float4x4 to a float3x4.
+     *
+     * Lossless for affine matrices; the projective row of @p m is dropped.
+     *
+     * @param m Affine 4x4 matrix.
+     * @return Equivalent 3x4 matrix.
+     */
+    inline float3x4 to_float3x4(const float4x4& m) noexcept
+    {
+        float4 c0{ m.columns[0] };
+        float4 c1{ m.columns[1] };
+        float4 c2{ m.columns[2] };
+        float4 c3{ m.columns[3] };
+        detail::transpose4(c0, c1, c2, c3);
+
+        return float3x4{ c0, c1, c2 };
+    }
+
+    /**
+     * @brief Expands a float3x4 to a float4x4 with bottom row {0, 0, 0, 1}.
+     *
+     * @param m Affine 3x4 matrix.
+     * @return Equivalent 4x4 matrix.
+     */
+    inline float4x4 to_float4x4(const float3x4& m) noexcept
+    {
+        float4 c0{ m.rows[0] };
+        float4 c1{ m.rows[1] };
+        float4 c2{ m.rows[2] };
+        float4 c3{ 0.f, 0.f, 0.f, 1.f };
+        detail::transpose4(c0, c1, c2, c3);
+
+        return float4x4{ c0, c1, c2, c3 };
+    }
+
+    // ========================================
+    // Multiplication
+    // ========================================
+
+    /**
+     * @brief Composes two affine transforms.
+     *
+     * Same order as mul(float4x4, float4x4): the result applies @p b first, then @p a.
+     * Each result row is a broadcast multiply-add over the rows of @p b (36 multiplies
+     * instead of 64 for the 4x4 product).
+     *
+     * @param a Outer transform.
+     * @param b Inner transform.
+     * @return Composed transform a * b.
+     */
+    inline float3x4 mul(const float3x4& a, const float3x4& b) noexcept
+    {
+        float3x4 result;
+        for (int i{ 0 }; i < 3; ++i)
+        {
+            const float4 r{ a.rows[i] };
+            result.rows[i] = r.x * b.rows[0] + r.y * b.rows[1] + r.z * b.rows[2];
+            result.rows[i].w += r.w;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Matrix-matrix multiplication operator.
+     */
+    inline float3x4 operator*(const float3x4& a, const float3x4& b) noexcept { return mul(a, b); }
+
+    /**
+     * @brief Transforms a point (implicit w = 1).
+     *
+     * @param m Affine transform.
+     * @param p Point to transform.
+     * @return Transformed point.
+     */
+    inline float3 transform_point(const float3x4& m, const float3 p) noexcept
+    {
+        const float4 p1{ p.x, p.y, p.z, 1.f };
+        return float3{ dot(m.rows[0], p1), dot(m.rows[1], p1), dot(m.rows[2], p1) };
+    }
+
+    /**
+     * @brief Transforms a direction vector (implicit w = 0, translation ignored).
+     *
+     * @param m Affine transform.
+     * @param v Vector to transform.
+     * @return Transformed vector.
+     */
+    inline float3 transform_vector(const float3x4& m, const float3 v) noexcept
+    {
+        return float3{ dot(m.rows[0].xyz, v), dot(m.rows[1].xyz, v), dot(m.rows[2].xyz, v) };
+    }
+
+    // ========================================
+    // Inverse
+    // ========================================
+
+    /**
+     * @brief Computes the inverse of an affine transform.
+     *
+     * Handles any invertible linear part (rotation, non-uniform scale, shear). The 3x3
+     * inverse comes from cross products of the rows (adjugate / determinant) and the
+     * translation is -A⁻¹t, so no 4x4 elimination is needed.
+     *
+     * @param m Affine transform.
+     * @return Inverse transform such that m * inverse(m) ≈ identity.
+     *         Returns identity if the linear part is singular or non-finite
+     *         (|det| <= epsilon * |r0| |r1| |r2|, relative to the row lengths).
+     */
+    inline float3x4 inverse(const float3x4& m) noexcept
+    {
+        const float3 r0{ m.rows[0].xyz };
+        const float3 r1{ m.rows[1].xyz };
+        const float3 r2{ m.rows[2].xyz };
+
+        // Columns of the adjugate are the cross products of the rows
+        const float3 a0{ cross(r1, r2) };
+        const float3 a1{ cross(r2, r0) };
+        const float3 a2{ cross(r0, r1) };
+
+        // |det| <= |r0| |r1| |r2| (Hadamard), so this singularity test is independent of
+        // the overall scale; it also rejects zero, inf and NaN determinants
+        const float det{ dot(r0, a0) };
+        if (!(abs(det) > epsilon * length(r0) * length(r1) * length(r2)))
+            return float3x4::identity();
+
+        const float inv_det{ 1.f / det };
+        const float3 c0{ a0 * inv_det };
+        const float3 c1{ a1 * inv_det };
+        const float3 c2{ a2 * inv_det };
+        const float3 t{ -(m.rows[0].w * c0 + m.rows[1].w * c1 + m.rows[2].w * c2) };
+
+        float4 row0{ c0.x, c0.y, c0.z, 0.f };
+        float4 row1{ c1.x, c1.y, c1.z, 0.f };
+        float4 row2{ c2.x, c2.y, c2.z, 0.f };
+        float4 row3{ t.x, t.y, t.z, 0.f };
+        detail::transpose4(row0, row1, row2, row3);
+
+        return float3x4{ row0, row1, row2 };
+    }
+} // namespace chlm
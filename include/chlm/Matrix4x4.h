@@ -6,6 +6,10 @@
 #pragma once
 
 #include "Core.h"
+#include "Dispatch.h"
+#include "Parallel.h"
+
+#include <span>
 
 namespace chlm {
     // ========================================
@@ -290,8 +294,8 @@ namespace chlm {
 
     inline float4x4 float4x4::rotate_x(const float rad) noexcept
     {
-        const float c{ cos(rad) };
-        const float s{ sin(rad) };
+        float s, c;
+        sincos(rad, s, c);
 
         return float4x4{
             float4{ 1.f, 0.f, 0.f, 0.f },
@@ -303,8 +307,8 @@ namespace chlm {
 
     inline float4x4 float4x4::rotate_y(const float rad) noexcept
     {
-        const float c{ cos(rad) };
-        const float s{ sin(rad) };
+        float s, c;
+        sincos(rad, s, c);
 
         return float4x4{
             float4{ c, 0.f, -s, 0.f },
@@ -316,8 +320,8 @@ namespace chlm {
 
     inline float4x4 float4x4::rotate_z(const float rad) noexcept
     {
-        const float c{ cos(rad) };
-        const float s{ sin(rad) };
+        float s, c;
+        sincos(rad, s, c);
 
         return float4x4{
             float4{ c, s, 0.f, 0.f },
@@ -330,8 +334,8 @@ namespace chlm {
     inline float4x4 float4x4::rotate_axis_angle(float3 axis, const float rad) noexcept
     {
         axis = normalize(axis);
-        const float c{ cos(rad) };
-        const float s{ sin(rad) };
+        float s, c;
+        sincos(rad, s, c);
         const float t{ 1.0f - c };
 
         const float x{ axis.x };
@@ -475,4 +479,320 @@ namespace chlm {
     {
         return ortho_off_center_rh_top_left(0.f, width, 0.f, height, z_near, z_far);
     }
+
+    // ========================================
+    // Batch transforms
+    // ========================================
+
+    /**
+     * @brief Transforms an array of points by an affine matrix (implicit w = 1).
+     *
+     * Equivalent to `out[i] = mul(m, float4{ in[i], 1 }).xyz` but keeps the matrix columns in
+     * registers, skips the w multiply and processes four points per iteration.
+     * The projective row is ignored; use mul() per point when a perspective divide is needed.
+     *
+     * @param m    Affine transformation matrix.
+     * @param in   Source points.
+     * @param out  Destination points (at least in.size() elements, may alias @p in).
+     * @param hint Cache policy for the destination.
+     */
+    inline void transform_points(const float4x4& m, const std::span<const float3> in, const std::span<float3> out,
+                                 const store_hint hint = store_hint::cached) noexcept
+    {
+        assert(out.size() >= in.size());
+
+        const float4 c0{ m.columns[0] };
+        const float4 c1{ m.columns[1] };
+        const float4 c2{ m.columns[2] };
+        const float4 c3{ m.columns[3] };
+        const size_t count{ in.size() };
+        float* dst{ reinterpret_cast<float*>(out.data()) };
+
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            size_t i{ 0 };
+            for (; i + 4 <= count; i += 4)
+            {
+                const float4 r0{ in[i + 0].x * c0 + in[i + 0].y * c1 + in[i + 0].z * c2 + c3 };
+                const float4 r1{ in[i + 1].x * c0 + in[i + 1].y * c1 + in[i + 1].z * c2 + c3 };
+                const float4 r2{ in[i + 2].x * c0 + in[i + 2].y * c1 + in[i + 2].z * c2 + c3 };
+                const float4 r3{ in[i + 3].x * c0 + in[i + 3].y * c1 + in[i + 3].z * c2 + c3 };
+
+                // float3 occupies a full 16-byte slot, so each result is written as one float4
+                detail::store(dst + (i + 0) * 4, r0, hint);
+                detail::store(dst + (i + 1) * 4, r1, hint);
+                detail::store(dst + (i + 2) * 4, r2, hint);
+                detail::store(dst + (i + 3) * 4, r3, hint);
+            }
+
+            for (; i < count; ++i)
+                detail::store(dst + i * 4, in[i].x * c0 + in[i].y * c1 + in[i].z * c2 + c3, hint);
+        });
+
+        if (hint == store_hint::streaming)
+            detail::stream_fence();
+    }
+
+    /**
+     * @brief Transforms an array of direction vectors by a matrix (implicit w = 0).
+     *
+     * Translation is ignored. See transform_points() for the batching behavior.
+     *
+     * @param m    Transformation matrix.
+     * @param in   Source vectors.
+     * @param out  Destination vectors (at least in.size() elements, may alias @p in).
+     * @param hint Cache policy for the destination.
+     */
+    inline void transform_vectors(const float4x4& m, const std::span<const float3> in, const std::span<float3> out,
+                                  const store_hint hint = store_hint::cached) noexcept
+    {
+        assert(out.size() >= in.size());
+
+        const float4 c0{ m.columns[0] };
+        const float4 c1{ m.columns[1] };
+        const float4 c2{ m.columns[2] };
+        const size_t count{ in.size() };
+        float* dst{ reinterpret_cast<float*>(out.data()) };
+
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            size_t i{ 0 };
+            for (; i + 4 <= count; i += 4)
+            {
+                const float4 r0{ in[i + 0].x * c0 + in[i + 0].y * c1 + in[i + 0].z * c2 };
+                const float4 r1{ in[i + 1].x * c0 + in[i + 1].y * c1 + in[i + 1].z * c2 };
+                const float4 r2{ in[i + 2].x * c0 + in[i + 2].y * c1 + in[i + 2].z * c2 };
+                const float4 r3{ in[i + 3].x * c0 + in[i + 3].y * c1 + in[i + 3].z * c2 };
+
+                detail::store(dst + (i + 0) * 4, r0, hint);
+                detail::store(dst + (i + 1) * 4, r1, hint);
+                detail::store(dst + (i + 2) * 4, r2, hint);
+                detail::store(dst + (i + 3) * 4, r3, hint);
+            }
+
+            for (; i < count; ++i)
+                detail::store(dst + i * 4, in[i].x * c0 + in[i].y * c1 + in[i].z * c2, hint);
+        });
+
+        if (hint == store_hint::streaming)
+            detail::stream_fence();
+    }
+
+    namespace detail {
+        /**
+         * @brief Shared SoA kernel for transform_points() / transform_vectors().
+         *
+         * Each matrix element is broadcast once; every iteration then transforms eight
+         * points with 9 (or 12) float8 multiply-adds and no wasted w lane.
+         */
+        template<bool Translate>
+        inline void transform_soa(const float4x4& m,
+                                  const std::span<const float> xs, const std::span<const float> ys,
+                                  const std::span<const float> zs,
+                                  const std::span<float> out_xs, const std::span<float> out_ys,
+                                  const std::span<float> out_zs, store_hint hint) noexcept
+        {
+            const size_t count{ xs.size() };
+            assert(ys.size() >= count && zs.size() >= count);
+            assert(out_xs.size() >= count && out_ys.size() >= count && out_zs.size() >= count);
+
+            if (!is_aligned(out_xs.data(), alignof(float8)) ||
+                !is_aligned(out_ys.data(), alignof(float8)) ||
+                !is_aligned(out_zs.data(), alignof(float8)))
+                hint = store_hint::cached;
+
+            const float m00{ m[0].x }, m01{ m[1].x }, m02{ m[2].x }, m03{ Translate ? m[3].x : 0.f };
+            const float m10{ m[0].y }, m11{ m[1].y }, m12{ m[2].y }, m13{ Translate ? m[3].y : 0.f };
+            const float m20{ m[0].z }, m21{ m[1].z }, m22{ m[2].z }, m23{ Translate ? m[3].z : 0.f };
+
+            dispatch([&]() CHLM_KERNEL
+            {
+                size_t i{ 0 };
+                for (; i + 8 <= count; i += 8)
+                {
+                    const float8 x{ load<float8>(xs.data() + i) };
+                    const float8 y{ load<float8>(ys.data() + i) };
+                    const float8 z{ load<float8>(zs.data() + i) };
+
+                    store(out_xs.data() + i, x * m00 + y * m01 + z * m02 + m03, hint);
+                    store(out_ys.data() + i, x * m10 + y * m11 + z * m12 + m13, hint);
+                    store(out_zs.data() + i, x * m20 + y * m21 + z * m22 + m23, hint);
+                }
+
+                for (; i < count; ++i)
+                {
+                    const float x{ xs[i] };
+                    const float y{ ys[i] };
+                    const float z{ zs[i] };
+
+                    out_xs[i] = x * m00 + y * m01 + z * m02 + m03;
+                    out_ys[i] = x * m10 + y * m11 + z * m12 + m13;
+                    out_zs[i] = x * m20 + y * m21 + z * m22 + m23;
+                }
+            });
+
+            if (hint == store_hint::streaming)
+                stream_fence();
+        }
+    } // namespace detail
+
+    /**
+     * @brief Transforms points stored as separate X/Y/Z arrays (structure-of-arrays).
+     *
+     * The SoA layout avoids the padding lane of float3 entirely and processes eight points
+     * per iteration. Streaming stores are used only when requested and all three destination
+     * arrays are 32-byte aligned.
+     *
+     * @param m      Affine transformation matrix.
+     * @param xs     Source X coordinates.
+     * @param ys     Source Y coordinates (at least xs.size() elements).
+     * @param zs     Source Z coordinates (at least xs.size() elements).
+     * @param out_xs Destination X coordinates (may alias @p xs).
+     * @param out_ys Destination Y coordinates (may alias @p ys).
+     * @param out_zs Destination Z coordinates (may alias @p zs).
+     * @param hint   Cache policy for the destination.
+     */
+    inline void transform_points(const float4x4& m,
+                                 const std::span<const float> xs, const std::span<const float> ys,
+                                 const std::span<const float> zs,
+                                 const std::span<float> out_xs, const std::span<float> out_ys,
+                                 const std::span<float> out_zs,
+                                 const store_hint hint = store_hint::cached) noexcept
+    {
+        detail::transform_soa<true>(m, xs, ys, zs, out_xs, out_ys, out_zs, hint);
+    }
+
+    /**
+     * @brief Transforms direction vectors stored as separate X/Y/Z arrays (translation ignored).
+     *
+     * @param m      Transformation matrix.
+     * @param xs     Source X components.
+     * @param ys     Source Y components (at least xs.size() elements).
+     * @param zs     Source Z components (at least xs.size() elements).
+     * @param out_xs Destination X components (may alias @p xs).
+     * @param out_ys Destination Y components (may alias @p ys).
+     * @param out_zs Destination Z components (may alias @p zs).
+     * @param hint   Cache policy for the destination.
+     */
+    inline void transform_vectors(const float4x4& m,
+                                  const std::span<const float> xs, const std::span<const float> ys,
+                                  const std::span<const float> zs,
+                                  const std::span<float> out_xs, const std::span<float> out_ys,
+                                  const std::span<float> out_zs,
+                                  const store_hint hint = store_hint::cached) noexcept
+    {
+        detail::transform_soa<false>(m, xs, ys, zs, out_xs, out_ys, out_zs, hint);
+    }
+
+    // ========================================
+    // Batch matrix multiplication
+    // ========================================
+
+    namespace detail {
+        /**
+         * @brief Shared kernel for the batch mul() overloads.
+         *
+         * FixedLeft computes out[i] = fixed * in[i] with the columns of @p fixed held in
+         * registers; otherwise out[i] = in[i] * fixed with its 16 elements hoisted as
+         * broadcast scalars. Fences its own streaming stores so each worker thread of a
+         * parallel batch publishes its results before returning.
+         */
+        template<bool FixedLeft>
+        inline void mul_batch(const float4x4& fixed, const std::span<const float4x4> in,
+                              const std::span<float4x4> out, const store_hint hint) noexcept
+        {
+            const size_t count{ in.size() };
+            float* dst{ reinterpret_cast<float*>(out.data()) };
+
+            dispatch([&]() CHLM_KERNEL
+            {
+                const float4 f0{ fixed.columns[0] };
+                const float4 f1{ fixed.columns[1] };
+                const float4 f2{ fixed.columns[2] };
+                const float4 f3{ fixed.columns[3] };
+
+                for (size_t i{ 0 }; i < count; ++i)
+                {
+                    const float4x4& m{ in[i] };
+                    float* result{ dst + i * 16 };
+
+                    if constexpr (FixedLeft)
+                    {
+                        for (int c{ 0 }; c < 4; ++c)
+                        {
+                            const float4 b{ m.columns[c] };
+                            store(result + c * 4, f0 * b.x + f1 * b.y + f2 * b.z + f3 * b.w, hint);
+                        }
+                    }
+                    else
+                    {
+                        const float4 a0{ m.columns[0] };
+                        const float4 a1{ m.columns[1] };
+                        const float4 a2{ m.columns[2] };
+                        const float4 a3{ m.columns[3] };
+
+                        store(result + 0, a0 * f0.x + a1 * f0.y + a2 * f0.z + a3 * f0.w, hint);
+                        store(result + 4, a0 * f1.x + a1 * f1.y + a2 * f1.z + a3 * f1.w, hint);
+                        store(result + 8, a0 * f2.x + a1 * f2.y + a2 * f2.z + a3 * f2.w, hint);
+                        store(result + 12, a0 * f3.x + a1 * f3.y + a2 * f3.z + a3 * f3.w, hint);
+                    }
+                }
+            });
+
+            if (hint == store_hint::streaming)
+                stream_fence();
+        }
+
+        /**
+         * @brief Runs mul_batch() inline or split across threads with parallel_for().
+         */
+        template<bool FixedLeft>
+        inline void mul_batch_chunked(const float4x4& fixed, const std::span<const float4x4> in,
+                                      const std::span<float4x4> out, const store_hint hint, const bool parallel)
+        {
+            assert(out.size() >= in.size());
+
+            constexpr size_t min_chunk{ 4096 };
+            if (parallel && in.size() >= 2 * min_chunk)
+                parallel_for(in.size(), min_chunk, [&](const size_t begin, const size_t end)
+                {
+                    mul_batch<FixedLeft>(fixed, in.subspan(begin, end - begin), out.subspan(begin), hint);
+                });
+            else
+                mul_batch<FixedLeft>(fixed, in, out, hint);
+        }
+    } // namespace detail
+
+    /**
+     * @brief Multiplies one matrix by an array of matrices: out[i] = a * bs[i].
+     *
+     * Typical use is view-projection * model for every instance. The columns of @p a stay
+     * in registers for the whole batch.
+     *
+     * @param a        Fixed left-hand matrix.
+     * @param bs       Right-hand matrices.
+     * @param out      Destination (at least bs.size() elements, may alias @p bs).
+     * @param hint     Cache policy for the destination (streaming suits GPU upload buffers).
+     * @param parallel Split large batches across threads with parallel_for().
+     */
+    inline void mul(const float4x4& a, const std::span<const float4x4> bs, const std::span<float4x4> out,
+                    const store_hint hint = store_hint::cached, const bool parallel = false)
+    {
+        detail::mul_batch_chunked<true>(a, bs, out, hint, parallel);
+    }
+
+    /**
+     * @brief Multiplies an array of matrices by one matrix: out[i] = as[i] * b.
+     *
+     * @param as       Left-hand matrices.
+     * @param b        Fixed right-hand matrix.
+     * @param out      Destination (at least as.size() elements, may alias @p as).
+     * @param hint     Cache policy for the destination.
+     * @param parallel Split large batches across threads with parallel_for().
+     */
+    inline void mul(const std::span<const float4x4> as, const float4x4& b, const std::span<float4x4> out,
+                    const store_hint hint = store_hint::cached, const bool parallel = false)
+    {
+        detail::mul_batch_chunked<false>(b, as, out, hint, parallel);
+    }
 } // namespace chlm
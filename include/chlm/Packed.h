@@ -0,0 +1,285 @@
+//
+// Created by Zack Shrout on 10/16/26.
+// Copyright (c) 2026 BunnySoft. All rights reserved.
+//
+
+#pragma once
+
+#include "Core.h"
+#include "Dispatch.h"
+#include "Matrix3x3.h"
+
+#include <span>
+
+namespace chlm {
+    // ========================================
+    // Packed storage types
+    // ========================================
+    // float3 is a 16-byte, 16-byte-aligned SIMD type. These plain structs match
+    // the tightly packed layouts GPUs expect (12-byte float3, 36-byte float3x3)
+    // and are meant for storage only: unpack to float3 to do math.
+
+    /**
+     * @brief Tightly packed 3-component float vector (12 bytes, 4-byte aligned).
+     */
+    struct packed_float3
+    {
+        float x{ };
+        float y{ };
+        float z{ };
+    };
+
+    static_assert(sizeof(packed_float3) == 12, "packed_float3 must be tightly packed");
+
+    /**
+     * @brief Tightly packed column-major 3x3 matrix (36 bytes).
+     */
+    struct packed_float3x3
+    {
+        packed_float3 columns[3]{
+            packed_float3{ 1.f, 0.f, 0.f },
+            packed_float3{ 0.f, 1.f, 0.f },
+            packed_float3{ 0.f, 0.f, 1.f }
+        }; // default is identity
+    };
+
+    static_assert(sizeof(packed_float3x3) == 36, "packed_float3x3 must be tightly packed");
+
+    /**
+     * @brief Converts a float3 to packed storage.
+     *
+     * @param v Vector to pack.
+     * @return Packed copy of @p v.
+     */
+    [[nodiscard]] constexpr packed_float3 to_packed(const float3 v) noexcept
+    {
+        return packed_float3{ v.x, v.y, v.z };
+    }
+
+    /**
+     * @brief Converts packed storage to a SIMD float3.
+     *
+     * @param p Packed vector.
+     * @return Equivalent float3.
+     */
+    [[nodiscard]] constexpr float3 to_float3(const packed_float3 p) noexcept
+    {
+        return float3{ p.x, p.y, p.z };
+    }
+
+    /**
+     * @brief Converts a float3x3 to packed storage.
+     *
+     * @param m Matrix to pack.
+     * @return Packed copy of @p m.
+     */
+    [[nodiscard]] constexpr packed_float3x3 to_packed(const float3x3& m) noexcept
+    {
+        return packed_float3x3{ to_packed(m[0]), to_packed(m[1]), to_packed(m[2]) };
+    }
+
+    /**
+     * @brief Converts packed storage to a float3x3.
+     *
+     * @param p Packed matrix.
+     * @return Equivalent float3x3.
+     */
+    [[nodiscard]] constexpr float3x3 to_float3x3(const packed_float3x3& p) noexcept
+    {
+        return float3x3{ to_float3(p.columns[0]), to_float3(p.columns[1]), to_float3(p.columns[2]) };
+    }
+
+    // ========================================
+    // Bulk pack / unpack
+    // ========================================
+    // Four vectors (48 bytes) are moved per iteration as three float4 loads or
+    // stores, re-laid with __builtin_shufflevector instead of 12 scalar moves.
+
+    /**
+     * @brief Packs an array of float3 into a tightly packed buffer.
+     *
+     * Streaming stores (e.g. straight into a mapped GPU upload buffer) are used only
+     * when requested and @p out is 16-byte aligned.
+     *
+     * @param in   Source vectors.
+     * @param out  Destination (at least in.size() elements).
+     * @param hint Cache policy for the destination.
+     */
+    inline void pack(const std::span<const float3> in, const std::span<packed_float3> out,
+                     store_hint hint = store_hint::cached) noexcept
+    {
+        assert(out.size() >= in.size());
+
+        float* dst{ reinterpret_cast<float*>(out.data()) };
+        if (!detail::is_aligned(dst, alignof(float4)))
+            hint = store_hint::cached;
+
+        const size_t count{ in.size() };
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            size_t i{ 0 };
+            for (; i + 4 <= count; i += 4)
+            {
+                const float3 a{ in[i + 0] };
+                const float3 b{ in[i + 1] };
+                const float3 c{ in[i + 2] };
+                const float3 d{ in[i + 3] };
+
+                float* group{ dst + i * 3 };
+                detail::store(group + 0, float4{ __builtin_shufflevector(a, b, 0, 1, 2, 3) }, hint); // ax ay az bx
+                detail::store(group + 4, float4{ __builtin_shufflevector(b, c, 1, 2, 3, 4) }, hint); // by bz cx cy
+                detail::store(group + 8, float4{ __builtin_shufflevector(c, d, 2, 3, 4, 5) }, hint); // cz dx dy dz
+            }
+
+            for (; i < count; ++i)
+                out[i] = to_packed(in[i]);
+        });
+
+        if (hint == store_hint::streaming)
+            detail::stream_fence();
+    }
+
+    /**
+     * @brief Packs the xyz part of an array of float4 into a tightly packed buffer (w is dropped).
+     *
+     * @param in   Source vectors.
+     * @param out  Destination (at least in.size() elements).
+     * @param hint Cache policy for the destination.
+     */
+    inline void pack(const std::span<const float4> in, const std::span<packed_float3> out,
+                     store_hint hint = store_hint::cached) noexcept
+    {
+        assert(out.size() >= in.size());
+
+        float* dst{ reinterpret_cast<float*>(out.data()) };
+        if (!detail::is_aligned(dst, alignof(float4)))
+            hint = store_hint::cached;
+
+        const size_t count{ in.size() };
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            size_t i{ 0 };
+            for (; i + 4 <= count; i += 4)
+            {
+                const float4 a{ in[i + 0] };
+                const float4 b{ in[i + 1] };
+                const float4 c{ in[i + 2] };
+                const float4 d{ in[i + 3] };
+
+                float* group{ dst + i * 3 };
+                detail::store(group + 0, float4{ __builtin_shufflevector(a, b, 0, 1, 2, 4) }, hint);
+                detail::store(group + 4, float4{ __builtin_shufflevector(b, c, 1, 2, 4, 5) }, hint);
+                detail::store(group + 8, float4{ __builtin_shufflevector(c, d, 2, 4, 5, 6) }, hint);
+            }
+
+            for (; i < count; ++i)
+                out[i] = to_packed(in[i].xyz);
+        });
+
+        if (hint == store_hint::streaming)
+            detail::stream_fence();
+    }
+
+    /**
+     * @brief Unpacks a tightly packed buffer into an array of float3.
+     *
+     * @param in  Packed source vectors.
+     * @param out Destination (at least in.size() elements).
+     */
+    inline void unpack(const std::span<const packed_float3> in, const std::span<float3> out) noexcept
+    {
+        assert(out.size() >= in.size());
+
+        const float* src{ reinterpret_cast<const float*>(in.data()) };
+        const size_t count{ in.size() };
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            size_t i{ 0 };
+            for (; i + 4 <= count; i += 4)
+            {
+                const float4 p0{ detail::load<float4>(src + i * 3 + 0) }; // ax ay az bx
+                const float4 p1{ detail::load<float4>(src + i * 3 + 4) }; // by bz cx cy
+                const float4 p2{ detail::load<float4>(src + i * 3 + 8) }; // cz dx dy dz
+
+                out[i + 0] = p0.xyz;
+                out[i + 1] = __builtin_shufflevector(p0, p1, 3, 4, 5);
+                out[i + 2] = __builtin_shufflevector(p1, p2, 2, 3, 4);
+                out[i + 3] = p2.yzw;
+            }
+
+            for (; i < count; ++i)
+                out[i] = to_float3(in[i]);
+        });
+    }
+
+    /**
+     * @brief Unpacks a tightly packed buffer into an array of float4 with a constant w.
+     *
+     * Use w = 1 for positions and w = 0 for directions.
+     *
+     * @param in  Packed source vectors.
+     * @param out Destination (at least in.size() elements).
+     * @param w   Value written to the w component of every output.
+     */
+    inline void unpack(const std::span<const packed_float3> in, const std::span<float4> out,
+                       const float w) noexcept
+    {
+        assert(out.size() >= in.size());
+
+        const float* src{ reinterpret_cast<const float*>(in.data()) };
+        const float4 ww{ w, w, w, w };
+        const size_t count{ in.size() };
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            size_t i{ 0 };
+            for (; i + 4 <= count; i += 4)
+            {
+                const float4 p0{ detail::load<float4>(src + i * 3 + 0) };
+                const float4 p1{ detail::load<float4>(src + i * 3 + 4) };
+                const float4 p2{ detail::load<float4>(src + i * 3 + 8) };
+
+                out[i + 0] = __builtin_shufflevector(p0, ww, 0, 1, 2, 4);
+                out[i + 1] = __builtin_shufflevector(__builtin_shufflevector(p0, p1, 3, 4, 5, 6), ww, 0, 1, 2, 4);
+                out[i + 2] = __builtin_shufflevector(__builtin_shufflevector(p1, p2, 2, 3, 4, 5), ww, 0, 1, 2, 4);
+                out[i + 3] = __builtin_shufflevector(p2, ww, 1, 2, 3, 4);
+            }
+
+            for (; i < count; ++i)
+                out[i] = float4{ in[i].x, in[i].y, in[i].z, w };
+        });
+    }
+
+    /**
+     * @brief Packs an array of float3x3 into tightly packed matrices.
+     *
+     * A float3x3 is three float3 columns, so this reuses the float3 kernel on
+     * the flattened column arrays.
+     *
+     * @param in   Source matrices.
+     * @param out  Destination (at least in.size() elements).
+     * @param hint Cache policy for the destination.
+     */
+    inline void pack(const std::span<const float3x3> in, const std::span<packed_float3x3> out,
+                     const store_hint hint = store_hint::cached) noexcept
+    {
+        assert(out.size() >= in.size());
+        static_assert(sizeof(float3x3) == 3 * sizeof(float3) && sizeof(packed_float3x3) == 3 * sizeof(packed_float3));
+
+        pack(std::span<const float3>{ reinterpret_cast<const float3*>(in.data()), in.size() * 3 },
+             std::span<packed_float3>{ reinterpret_cast<packed_float3*>(out.data()), out.size() * 3 }, hint);
+    }
+
+    /**
+     * @brief Unpacks tightly packed matrices into an array of float3x3.
+     *
+     * @param in  Packed source matrices.
+     * @param out Destination (at least in.size() elements).
+     */
+    inline void unpack(const std::span<const packed_float3x3> in, const std::span<float3x3> out) noexcept
+    {
+        assert(out.size() >= in.size());
+
+        unpack(std::span<const packed_float3>{ reinterpret_cast<const packed_float3*>(in.data()), in.size() * 3 },
+               std::span<float3>{ reinterpret_cast<float3*>(out.data()), out.size() * 3 });
+    }
+} // namespace chlm
@@ -0,0 +1,55 @@
+//
+// Created by Zack Shrout on 10/16/26.
+// Copyright (c) 2026 BunnySoft. All rights reserved.
+//
+
+#pragma once
+
+#include "Core.h"
+
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace chlm {
+    /**
+     * @brief Splits the index range [0, count) into contiguous chunks and runs them concurrently.
+     *
+     * Chunks are executed with std::async; the calling thread processes the first chunk
+     * itself and then waits for the rest. No more chunks than hardware threads are
+     * created, and no chunk is smaller than @p min_chunk, so small ranges run inline
+     * without spawning anything.
+     *
+     * @tparam Fn Callable as fn(size_t begin, size_t end).
+     * @param count     Number of indices to process.
+     * @param min_chunk Minimum number of indices per chunk (amortizes thread start-up).
+     * @param fn        Work function invoked once per chunk.
+     */
+    template<typename Fn>
+    void parallel_for(const size_t count, const size_t min_chunk, const Fn& fn)
+    {
+        const size_t hardware{ max<size_t>(std::thread::hardware_concurrency(), 1) };
+        const size_t chunks{ min(hardware, max<size_t>(count / max<size_t>(min_chunk, 1), 1)) };
+
+        if (chunks <= 1)
+        {
+            fn(size_t{ 0 }, count);
+            return;
+        }
+
+        const size_t step{ (count + chunks - 1) / chunks };
+        std::vector<std::future<void>> pending;
+        pending.reserve(chunks - 1);
+
+        for (size_t begin{ step }; begin < count; begin += step)
+        {
+            const size_t end{ min(begin + step, count) };
+            pending.push_back(std::async(std::launch::async, [&fn, begin, end] { fn(begin, end); }));
+        }
+
+        fn(size_t{ 0 }, step);
+
+        for (std::future<void>& f : pending)
+            f.get();
+    }
+} // namespace chlm
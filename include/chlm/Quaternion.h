@@ -6,6 +6,11 @@
 #pragma once
 
 #include "Core.h"
+#include "Dispatch.h"
+#include "Vector.h"
+#include "SoA.h"
+
+#include <span>
 
 namespace chlm {
     // ========================================
@@ -34,10 +39,10 @@ namespace chlm {
      */
     inline quat quat_from_axis_angle(float3 axis, const float rad) noexcept
     {
-        const float half{ rad * .5f };
-        const float s{ sin(half) };
+        float s, c;
+        sincos(rad * .5f, s, c);
 
-        return quat{ axis.x * s, axis.y * s, axis.z * s, cos(half) };
+        return quat{ axis.x * s, axis.y * s, axis.z * s, c };
     }
 
     /**
@@ -53,12 +58,29 @@ namespace chlm {
      */
     inline quat quat_from_euler(const float yaw_z, const float pitch_x, const float roll_y) noexcept
     {
-        const float cy{ cos(yaw_z * .5f) };
-        const float sy{ sin(yaw_z * .5f) };
-        const float cp{ cos(pitch_x * .5f) };
-        const float sp{ sin(pitch_x * .5f) };
-        const float cr{ cos(roll_y * .5f) };
-        const float sr{ sin(roll_y * .5f) };
+        // All three half-angle pairs from one SIMD range reduction; angles outside the
+        // polynomial range (or non-finite) take the scalar sincos() fallback per angle
+        const float4 half{ float4{ yaw_z, pitch_x, roll_y, 0.f } * .5f };
+        float4 s, c;
+        if (detail::movemask(abs(half) <= detail::sincos_range) == 0xF)
+            sincos(half, s, c);
+        else
+        {
+            for (int i{ 0 }; i < 3; ++i)
+            {
+                float si, ci;
+                sincos(half[i], si, ci);
+                s[i] = si;
+                c[i] = ci;
+            }
+        }
+
+        const float cy{ c.x };
+        const float sy{ s.x };
+        const float cp{ c.y };
+        const float sp{ s.y };
+        const float cr{ c.z };
+        const float sr{ s.z };
 
         return quat{
             sr * cp * cy - cr * sp * sy, // x
@@ -68,23 +90,38 @@ namespace chlm {
         };
     }
 
+    namespace detail {
+        /**
+         * @brief Flips the sign of the lanes whose mask lane is -0.f (xor of the sign bit).
+         */
+        [[nodiscard]] inline float4 flip_signs(const float4 v, const int4 sign_mask) noexcept
+        {
+            return __builtin_bit_cast(float4, __builtin_bit_cast(int4, v) ^ sign_mask);
+        }
+    } // namespace detail
+
     /**
      * @brief Multiplies two quaternions (Hamilton product).
      *
-     * Equivalent to combining two rotations: result = a followed by b.
+     * Equivalent to combining two rotations: the result applies @p b first and then @p a,
+     * so rotate_vector(mul(a, b), v) == rotate_vector(a, rotate_vector(b, v)).
+     * Each lane of @p a is broadcast against a lane permutation of @p b whose signs are
+     * fixed with an xor, so the product is four float4 multiply-adds instead of sixteen
+     * scalar products.
      *
-     * @param a First quaternion (applied first in rotation order).
-     * @param b Second quaternion (applied after a).
+     * @param a Outer rotation (applied last).
+     * @param b Inner rotation (applied first).
      * @return Quaternion representing the composed rotation.
      */
     inline quat mul(const quat& a, const quat& b) noexcept
     {
-        return quat{
-            a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
-            a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
-            a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
-            a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
-        };
+        constexpr int neg{ __builtin_bit_cast(int, -0.f) };
+
+        const float4 bx{ detail::flip_signs(__builtin_shufflevector(b, b, 3, 2, 1, 0), int4{ 0, neg, 0, neg }) };
+        const float4 by{ detail::flip_signs(__builtin_shufflevector(b, b, 2, 3, 0, 1), int4{ 0, 0, neg, neg }) };
+        const float4 bz{ detail::flip_signs(__builtin_shufflevector(b, b, 1, 0, 3, 2), int4{ neg, 0, 0, neg }) };
+
+        return a.w * b + a.x * bx + a.y * by + a.z * bz;
     }
 
     /**
@@ -172,22 +209,318 @@ namespace chlm {
         return a * wa + b_adj * wb;
     }
 
+    namespace detail {
+        // Eberly's series coefficients u_i = 1 / (i(2i + 1)) and v_i = i / (2i + 1), i = 1..8.
+        // The last pair is scaled by 1 + mu to absorb the truncated tail of the series.
+        inline constexpr float slerp_u[8]{
+            1.f / 3.f, 1.f / 10.f, 1.f / 21.f, 1.f / 36.f, 1.f / 55.f, 1.f / 78.f, 1.f / 105.f, 1.85298109f / 136.f
+        };
+        inline constexpr float slerp_v[8]{
+            1.f / 3.f, 2.f / 5.f, 3.f / 7.f, 4.f / 9.f, 5.f / 11.f, 6.f / 13.f, 7.f / 15.f, 1.85298109f * 8.f / 17.f
+        };
+
+        /**
+         * @brief Approximates sin(t * theta) / sin(theta) from xm1 = cos(theta) - 1.
+         *
+         * Works for float and for float vectors (all lanes at once).
+         */
+        template<typename V>
+        [[nodiscard]] CHLM_INLINE V slerp_weight(const V t, const V xm1) noexcept
+        {
+            const V t2{ t * t };
+            V r{ 1.f + (slerp_u[7] * t2 - slerp_v[7]) * xm1 };
+            for (int i{ 6 }; i >= 0; --i)
+                r = 1.f + (slerp_u[i] * t2 - slerp_v[i]) * xm1 * r;
+            return t * r;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Approximate spherical linear interpolation without acos, sin or branches.
+     *
+     * Evaluates the slerp weights with Eberly's polynomial series in cos(theta), truncated
+     * after eight terms with a corrected last term. Takes the shortest path like slerp().
+     * The weights are within 1.9e-5 of exact slerp for any pair of rotations, and within
+     * 1e-6 when the rotations differ by at most 120 degrees (|dot(a, b)| >= 0.5); identical
+     * inputs need no special case.
+     *
+     * @param a Start quaternion (should be unit-length).
+     * @param b End quaternion (should be unit-length).
+     * @param t Interpolation factor (0 = a, 1 = b).
+     * @return Interpolated quaternion along the great circle arc.
+     */
+    inline quat slerp_fast(const quat& a, const quat& b, const float t) noexcept
+    {
+        const float d{ dot(a, b) };
+        const float sign{ d < 0.f ? -1.f : 1.f };
+        const float xm1{ abs(d) - 1.f };
+
+        return a * detail::slerp_weight(1.f - t, xm1) + b * (sign * detail::slerp_weight(t, xm1));
+    }
+
     /**
      * @brief Rotates a 3D vector by a quaternion.
      *
-     * Uses the formula q * v * q⁻¹. Assumes the quaternion is normalized
-     * (uses conjugate as inverse for performance).
+     * Evaluates q * v * q⁻¹ in expanded form, v' = v + 2w(u × v) + 2u × (u × v) with u = q.xyz,
+     * which is two SIMD cross products instead of two full Hamilton products.
+     * Assumes the quaternion is normalized.
      *
      * @param q Unit quaternion representing the rotation.
      * @param v Vector to rotate.
      * @return Rotated vector.
      */
-    inline float3 rotate_vector(const quat& q, float3 v) noexcept
+    CHLM_INLINE float3 rotate_vector(const quat& q, const float3 v) noexcept
+    {
+        const float3 u{ q.xyz };
+        const float3 t{ 2.f * cross(u, v) };
+
+        return v + q.w * t + cross(u, t);
+    }
+
+    /**
+     * @brief Rotates an array of vectors by one quaternion.
+     *
+     * @param q   Unit quaternion representing the rotation.
+     * @param in  Source vectors.
+     * @param out Destination vectors (at least in.size() elements, may alias @p in).
+     */
+    inline void rotate_vectors(const quat& q, const std::span<const float3> in, const std::span<float3> out) noexcept
     {
-        const quat vq{ v.x, v.y, v.z, 0.f };
-        const quat q_inv{ conjugate(q) }; // assumes q is normalized
-        quat result{ mul(mul(q, vq), q_inv) };
+        assert(out.size() >= in.size());
 
-        return result.xyz;
+        const size_t count{ in.size() };
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            for (size_t i{ 0 }; i < count; ++i)
+                out[i] = rotate_vector(q, in[i]);
+        });
+    }
+
+    /**
+     * @brief Rotates each vector by its own quaternion: out[i] = rotate_vector(qs[i], in[i]).
+     *
+     * @param qs  Unit quaternions (at least in.size() elements).
+     * @param in  Source vectors.
+     * @param out Destination vectors (at least in.size() elements, may alias @p in).
+     */
+    inline void rotate_vectors(const std::span<const quat> qs, const std::span<const float3> in,
+                               const std::span<float3> out) noexcept
+    {
+        assert(qs.size() >= in.size() && out.size() >= in.size());
+
+        const size_t count{ in.size() };
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            for (size_t i{ 0 }; i < count; ++i)
+                out[i] = rotate_vector(qs[i], in[i]);
+        });
+    }
+
+    // ========================================
+    // Batch quaternion multiplication (SoA)
+    // ========================================
+
+    namespace detail {
+        /**
+         * @brief Hamilton product on SoA lanes; V is float for the scalar tail or float8.
+         */
+        template<typename V>
+        CHLM_INLINE void mul_lanes(const V ax, const V ay, const V az, const V aw,
+                                   const V bx, const V by, const V bz, const V bw,
+                                   V& x, V& y, V& z, V& w) noexcept
+        {
+            x = aw * bx + ax * bw + ay * bz - az * by;
+            y = aw * by - ax * bz + ay * bw + az * bx;
+            z = aw * bz + ax * by - ay * bx + az * bw;
+            w = aw * bw - ax * bx - ay * by - az * bz;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Multiplies quaternions element-wise: out[i] = mul(a[i], b[i]).
+     *
+     * In SoA form every component is a full float8, so eight products take sixteen
+     * multiplies and twelve adds per output component with no shuffles at all.
+     * Resizes @p out to a.size().
+     *
+     * @param a   Outer rotations (applied last).
+     * @param b   Inner rotations (applied first, same size as @p a).
+     * @param out Destination (may be the same container as @p a or @p b).
+     */
+    inline void mul(const quat_soa& a, const quat_soa& b, quat_soa& out)
+    {
+        assert(b.size() == a.size());
+
+        const size_t count{ a.size() };
+        out.resize(count);
+
+        const float* ax{ a.x().data() };
+        const float* ay{ a.y().data() };
+        const float* az{ a.z().data() };
+        const float* aw{ a.w().data() };
+        const float* bx{ b.x().data() };
+        const float* by{ b.y().data() };
+        const float* bz{ b.z().data() };
+        const float* bw{ b.w().data() };
+        float* ox{ out.x().data() };
+        float* oy{ out.y().data() };
+        float* oz{ out.z().data() };
+        float* ow{ out.w().data() };
+
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            size_t i{ 0 };
+            for (; i + 8 <= count; i += 8)
+            {
+                float8 x, y, z, w;
+                detail::mul_lanes(detail::load<float8>(ax + i), detail::load<float8>(ay + i),
+                                  detail::load<float8>(az + i), detail::load<float8>(aw + i),
+                                  detail::load<float8>(bx + i), detail::load<float8>(by + i),
+                                  detail::load<float8>(bz + i), detail::load<float8>(bw + i),
+                                  x, y, z, w);
+
+                detail::store(ox + i, x, store_hint::cached);
+                detail::store(oy + i, y, store_hint::cached);
+                detail::store(oz + i, z, store_hint::cached);
+                detail::store(ow + i, w, store_hint::cached);
+            }
+
+            for (; i < count; ++i)
+                detail::mul_lanes(ax[i], ay[i], az[i], aw[i], bx[i], by[i], bz[i], bw[i], ox[i], oy[i], oz[i], ow[i]);
+        });
+    }
+
+    // ========================================
+    // Batch interpolation (SoA)
+    // ========================================
+    // Eight quaternion pairs are blended per iteration on float8 component lanes. The
+    // component arrays of a quat_soa are padded to a multiple of 16, so the kernels run
+    // whole blocks up to padded_size() and need no scalar tail.
+
+    namespace detail {
+        /**
+         * @brief slerp_fast() on SoA lanes with a per-lane interpolation factor.
+         *
+         * Branch-free: the shortest-path flip is an xor of the sign of dot(a, b) into the
+         * weight of b.
+         */
+        template<typename V>
+        CHLM_INLINE void slerp_lanes(const V ax, const V ay, const V az, const V aw,
+                                     const V bx, const V by, const V bz, const V bw, const V t,
+                                     V& x, V& y, V& z, V& w) noexcept
+        {
+            using I = mask_t<V>;
+
+            const V d{ ax * bx + ay * by + az * bz + aw * bw };
+            const I sign{ __builtin_bit_cast(I, d) & __builtin_bit_cast(int, -0.f) };
+            const V xm1{ __builtin_elementwise_abs(d) - 1.f };
+
+            const V wa{ slerp_weight(1.f - t, xm1) };
+            const V wb{ __builtin_bit_cast(V, __builtin_bit_cast(I, slerp_weight(t, xm1)) ^ sign) };
+
+            x = ax * wa + bx * wb;
+            y = ay * wa + by * wb;
+            z = az * wa + bz * wb;
+            w = aw * wa + bw * wb;
+        }
+
+        /**
+         * @brief Runs @p op over aligned 8-lane blocks of two quaternion arrays.
+         *
+         * @param op Callable (ax, ay, az, aw, bx, by, bz, bw, x&, y&, z&, w&) on float8 lanes.
+         */
+        template<typename Op>
+        inline void blend_soa(const quat_soa& a, const quat_soa& b, quat_soa& out, const Op& op)
+        {
+            assert(b.size() == a.size());
+
+            out.resize(a.size());
+            const size_t padded{ out.padded_size() };
+
+            const float* ax{ a.x().data() };
+            const float* ay{ a.y().data() };
+            const float* az{ a.z().data() };
+            const float* aw{ a.w().data() };
+            const float* bx{ b.x().data() };
+            const float* by{ b.y().data() };
+            const float* bz{ b.z().data() };
+            const float* bw{ b.w().data() };
+            float* ox{ out.x().data() };
+            float* oy{ out.y().data() };
+            float* oz{ out.z().data() };
+            float* ow{ out.w().data() };
+
+            dispatch([&]() CHLM_KERNEL
+            {
+                for (size_t i{ 0 }; i < padded; i += 8)
+                {
+                    float8 x, y, z, w;
+                    op(load<float8>(ax + i), load<float8>(ay + i), load<float8>(az + i), load<float8>(aw + i),
+                       load<float8>(bx + i), load<float8>(by + i), load<float8>(bz + i), load<float8>(bw + i),
+                       x, y, z, w);
+
+                    store(ox + i, x, store_hint::cached);
+                    store(oy + i, y, store_hint::cached);
+                    store(oz + i, z, store_hint::cached);
+                    store(ow + i, w, store_hint::cached);
+                }
+            });
+        }
+    } // namespace detail
+
+    /**
+     * @brief Normalized linear interpolation of quaternion arrays: out[i] = nlerp(a[i], b[i], t).
+     *
+     * Like nlerp(), no hemisphere flip is applied and a zero-length blend (a = -b at
+     * t = 0.5) gives a zero quaternion. The result is normalized with rsqrt(), so its
+     * length is 1 within 3e-7. Resizes @p out to a.size().
+     *
+     * @param a   Start quaternions.
+     * @param b   End quaternions (same size as @p a).
+     * @param t   Interpolation factor shared by all elements (0 = a, 1 = b).
+     * @param out Destination (may be the same container as @p a or @p b).
+     */
+    inline void nlerp(const quat_soa& a, const quat_soa& b, const float t, quat_soa& out)
+    {
+        detail::blend_soa(a, b, out,
+            [t](const float8 ax, const float8 ay, const float8 az, const float8 aw,
+                const float8 bx, const float8 by, const float8 bz, const float8 bw,
+                float8& x, float8& y, float8& z, float8& w) CHLM_KERNEL
+            {
+                x = ax + (bx - ax) * t;
+                y = ay + (by - ay) * t;
+                z = az + (bz - az) * t;
+                w = aw + (bw - aw) * t;
+
+                // Zero lengths select 0 like normalize_fast() instead of rsqrt's NaN
+                const float8 len_sq{ x * x + y * y + z * z + w * w };
+                const float8 inv_len{ detail::select(len_sq > epsilon * epsilon, rsqrt(len_sq), float8{ }) };
+                x *= inv_len;
+                y *= inv_len;
+                z *= inv_len;
+                w *= inv_len;
+            });
+    }
+
+    /**
+     * @brief Spherical linear interpolation of quaternion arrays: out[i] = slerp_fast(a[i], b[i], t).
+     *
+     * Branch-free, with the weights from the polynomial series of slerp_fast() (same
+     * error bounds). Resizes @p out to a.size().
+     *
+     * @param a   Start quaternions (unit-length).
+     * @param b   End quaternions (unit-length, same size as @p a).
+     * @param t   Interpolation factor shared by all elements (0 = a, 1 = b).
+     * @param out Destination (may be the same container as @p a or @p b).
+     */
+    inline void slerp(const quat_soa& a, const quat_soa& b, const float t, quat_soa& out)
+    {
+        detail::blend_soa(a, b, out,
+            [t](const float8 ax, const float8 ay, const float8 az, const float8 aw,
+                const float8 bx, const float8 by, const float8 bz, const float8 bw,
+                float8& x, float8& y, float8& z, float8& w) CHLM_KERNEL
+            {
+                detail::slerp_lanes(ax, ay, az, aw, bx, by, bz, bw, float8{ } + t, x, y, z, w);
+            });
     }
 } // namespace chlm
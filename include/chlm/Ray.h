@@ -0,0 +1,253 @@
+//
+// Created by Zack Shrout on 10/16/26.
+// Copyright (c) 2026 BunnySoft. All rights reserved.
+//
+
+#pragma once
+
+#include "Core.h"
+#include "Vector.h"
+#include "Aabb.h"
+
+#include <span>
+
+namespace chlm {
+    // ========================================
+    // Ray
+    // ========================================
+
+    /**
+     * @brief Ray with a parametric interval: points origin + t * direction for t in [t_min, t_max].
+     *
+     * The direction does not need to be normalized; hit distances are then in units
+     * of its length.
+     */
+    struct ray
+    {
+        float3 origin{ };
+        float3 direction{ 0.f, 0.f, 1.f };
+        float t_min{ 0.f };
+        float t_max{ infinity };
+    };
+
+    /**
+     * @brief Returns the point at parameter @p t along a ray.
+     *
+     * @param r Ray to evaluate.
+     * @param t Ray parameter.
+     * @return origin + t * direction.
+     */
+    [[nodiscard]] constexpr float3 point_at(const ray& r, const float t) noexcept
+    {
+        return r.origin + r.direction * t;
+    }
+
+    /**
+     * @brief Intersects a ray with an axis-aligned box (slab test).
+     *
+     * All three slabs are clipped at once in one float4; the fourth lane carries the ray
+     * interval so a single horizontal max/min yields the entry and exit distances.
+     *
+     * @param r   Ray to cast.
+     * @param box Box to test.
+     * @param t   Receives the entry distance (clamped to r.t_min) on a hit.
+     * @return true if the ray overlaps the box within [t_min, t_max]; false for an empty() box.
+     */
+    [[nodiscard]] inline bool raycast(const ray& r, const aabb3& box, float& t) noexcept
+    {
+        const float4 origin{ r.origin.x, r.origin.y, r.origin.z, 0.f };
+        const float4 inv_dir{ 1.f / float4{ r.direction.x, r.direction.y, r.direction.z, 1.f } };
+
+        const float4 t0{ (box.min - origin) * inv_dir };
+        const float4 t1{ (box.max - origin) * inv_dir };
+
+        float4 t_near{ min(t0, t1) };
+        float4 t_far{ max(t0, t1) };
+        t_near.w = r.t_min;
+        t_far.w = r.t_max;
+
+        const float enter{ hmax(t_near) };
+        const float exit{ hmin(t_far) };
+        // Inverted slabs would be swapped back into a valid interval by min/max
+        t = enter;
+        return enter <= exit && !empty(box);
+    }
+
+    /**
+     * @brief Intersects a ray with a triangle (Möller-Trumbore, two-sided).
+     *
+     * @param r  Ray to cast.
+     * @param v0 First vertex.
+     * @param v1 Second vertex.
+     * @param v2 Third vertex.
+     * @param t  Receives the hit distance.
+     * @param u  Receives the barycentric weight of @p v1.
+     * @param v  Receives the barycentric weight of @p v2.
+     * @return true if the ray hits the triangle within [t_min, t_max].
+     */
+    [[nodiscard]] inline bool raycast(const ray& r, const float3 v0, const float3 v1, const float3 v2,
+                                      float& t, float& u, float& v) noexcept
+    {
+        const float3 e1{ v1 - v0 };
+        const float3 e2{ v2 - v0 };
+        const float3 p{ cross(r.direction, e2) };
+
+        const float det{ dot(e1, p) };
+        if (abs(det) < epsilon * epsilon)
+            return false;  // Parallel to the triangle plane
+
+        const float inv_det{ 1.f / det };
+        const float3 s{ r.origin - v0 };
+        const float3 q{ cross(s, e1) };
+
+        u = dot(s, p) * inv_det;
+        v = dot(r.direction, q) * inv_det;
+        t = dot(e2, q) * inv_det;
+
+        return u >= 0.f && v >= 0.f && u + v <= 1.f && t >= r.t_min && t <= r.t_max;
+    }
+
+    // ========================================
+    // Ray packets (SoA, 4 or 8 rays)
+    // ========================================
+    // Each lane holds one ray; inverse directions are precomputed once per packet
+    // for the slab test. Packet kernels return a hit bitmask (lane i -> bit i), the
+    // same convention as the frustum culling batches, plus per-lane distances.
+
+    /**
+     * @brief Structure-of-arrays bundle of rays, one per lane of @p V.
+     *
+     * @tparam V float4 or float8.
+     */
+    template<typename V>
+    struct ray_packet
+    {
+        static constexpr size_t lanes{ sizeof(V) / sizeof(float) };
+
+        V origin_x{ }, origin_y{ }, origin_z{ };
+        V dir_x{ }, dir_y{ }, dir_z{ };
+        V inv_dir_x{ }, inv_dir_y{ }, inv_dir_z{ };
+        V t_min{ };
+        V t_max{ };
+    };
+
+    using ray_packet4 = ray_packet<float4>;
+    using ray_packet8 = ray_packet<float8>;
+
+    /**
+     * @brief Gathers up to ray_packet<V>::lanes rays into a packet.
+     *
+     * Lanes past rays.size() get an empty interval (t_min > t_max) so they never hit.
+     *
+     * @tparam V float4 or float8.
+     * @param rays Source rays.
+     * @return Packet with precomputed inverse directions.
+     */
+    template<typename V>
+    [[nodiscard]] inline ray_packet<V> make_ray_packet(const std::span<const ray> rays) noexcept
+    {
+        assert(rays.size() <= ray_packet<V>::lanes);
+
+        ray_packet<V> p;
+        p.dir_z = V{ } + 1.f;
+        p.t_min = V{ } + infinity;
+        p.t_max = V{ } - infinity;
+
+        for (size_t i{ 0 }; i < rays.size(); ++i)
+        {
+            const ray& r{ rays[i] };
+            p.origin_x[i] = r.origin.x;
+            p.origin_y[i] = r.origin.y;
+            p.origin_z[i] = r.origin.z;
+            p.dir_x[i] = r.direction.x;
+            p.dir_y[i] = r.direction.y;
+            p.dir_z[i] = r.direction.z;
+            p.t_min[i] = r.t_min;
+            p.t_max[i] = r.t_max;
+        }
+
+        p.inv_dir_x = 1.f / p.dir_x;
+        p.inv_dir_y = 1.f / p.dir_y;
+        p.inv_dir_z = 1.f / p.dir_z;
+        return p;
+    }
+
+    /**
+     * @brief Intersects every ray of a packet with one axis-aligned box (slab test).
+     *
+     * Axis-parallel rays are handled through the IEEE infinities in the inverse
+     * direction; lane-wise min/max discard the NaN produced when such a ray starts
+     * exactly on a slab plane.
+     *
+     * @tparam V float4 or float8.
+     * @param p   Ray packet.
+     * @param box Box to test.
+     * @param t   Receives the per-lane entry distance (valid for hit lanes).
+     * @return Hit bitmask, bit i set if ray i overlaps the box within its interval; 0 for an
+     *         empty() box.
+     */
+    template<typename V>
+    [[nodiscard]] inline uint32_t raycast(const ray_packet<V>& p, const aabb3& box, V& t) noexcept
+    {
+        const V tx0{ (box.min.x - p.origin_x) * p.inv_dir_x };
+        const V tx1{ (box.max.x - p.origin_x) * p.inv_dir_x };
+        const V ty0{ (box.min.y - p.origin_y) * p.inv_dir_y };
+        const V ty1{ (box.max.y - p.origin_y) * p.inv_dir_y };
+        const V tz0{ (box.min.z - p.origin_z) * p.inv_dir_z };
+        const V tz1{ (box.max.z - p.origin_z) * p.inv_dir_z };
+
+        const V enter{ max(max(min(tx0, tx1), min(ty0, ty1)), max(min(tz0, tz1), p.t_min)) };
+        const V exit{ min(min(max(tx0, tx1), max(ty0, ty1)), min(max(tz0, tz1), p.t_max)) };
+
+        // Inverted slabs would be swapped back into a valid interval by min/max
+        const uint32_t valid{ empty(box) ? 0u : ~0u };
+        t = enter;
+        return detail::movemask(enter <= exit) & valid;
+    }
+
+    /**
+     * @brief Intersects every ray of a packet with one triangle (Möller-Trumbore, two-sided).
+     *
+     * The triangle edges are broadcast once; each lane then runs the branch-free test.
+     *
+     * @tparam V float4 or float8.
+     * @param p  Ray packet.
+     * @param v0 First vertex.
+     * @param v1 Second vertex.
+     * @param v2 Third vertex.
+     * @param t  Receives per-lane hit distances (valid for hit lanes).
+     * @param u  Receives per-lane barycentric weights of @p v1.
+     * @param v  Receives per-lane barycentric weights of @p v2.
+     * @return Hit bitmask, bit i set if ray i hits the triangle within its interval.
+     */
+    template<typename V>
+    [[nodiscard]] inline uint32_t raycast(const ray_packet<V>& p, const float3 v0, const float3 v1, const float3 v2,
+                                   V& t, V& u, V& v) noexcept
+    {
+        const float3 e1{ v1 - v0 };
+        const float3 e2{ v2 - v0 };
+
+        // p = cross(dir, e2)
+        const V px{ p.dir_y * e2.z - p.dir_z * e2.y };
+        const V py{ p.dir_z * e2.x - p.dir_x * e2.z };
+        const V pz{ p.dir_x * e2.y - p.dir_y * e2.x };
+        const V det{ e1.x * px + e1.y * py + e1.z * pz };
+        const V inv_det{ 1.f / det };
+
+        // s = origin - v0, q = cross(s, e1)
+        const V sx{ p.origin_x - v0.x };
+        const V sy{ p.origin_y - v0.y };
+        const V sz{ p.origin_z - v0.z };
+        const V qx{ sy * e1.z - sz * e1.y };
+        const V qy{ sz * e1.x - sx * e1.z };
+        const V qz{ sx * e1.y - sy * e1.x };
+
+        u = (sx * px + sy * py + sz * pz) * inv_det;
+        v = (p.dir_x * qx + p.dir_y * qy + p.dir_z * qz) * inv_det;
+        t = (e2.x * qx + e2.y * qy + e2.z * qz) * inv_det;
+
+        const auto hit{ (abs(det) >= epsilon * epsilon) & (u >= 0.f) & (v >= 0.f) & (u + v <= 1.f) &
+                        (t >= p.t_min) & (t <= p.t_max) };
+        return detail::movemask(hit);
+    }
+} // namespace chlm
@@ -0,0 +1,212 @@
+//
+// Created by Zack Shrout on 10/16/26.
+// Copyright (c) 2026 BunnySoft. All rights reserved.
+//
+
+#pragma once
+
+#include "Core.h"
+#include "Dispatch.h"
+#include "Vector.h"
+#include "Matrix3x4.h"
+#include "DualQuaternion.h"
+#include "SoA.h"
+
+#include <span>
+
+namespace chlm {
+    // ========================================
+    // Skinning (4 influences per vertex)
+    // ========================================
+    // Vertex streams are SoA (float3_soa positions / normals); influences are one uint4 of
+    // palette indices and one float4 of weights per vertex (weights should sum to 1).
+    // Every vertex gathers four arbitrary palette entries, so vertices are processed one
+    // at a time and the SIMD width goes into blending the palette entries: three float4
+    // rows for a float3x4, two float4 parts for a dual_quat.
+
+    namespace detail {
+        /**
+         * @brief Blends the four palette matrices of one vertex (linear blend skinning).
+         */
+        [[nodiscard]] CHLM_INLINE float3x4 blend_palette(const std::span<const float3x4> palette,
+                                                         const uint4 joints, const float4 weights) noexcept
+        {
+            assert(joints.x < palette.size() && joints.y < palette.size() &&
+                   joints.z < palette.size() && joints.w < palette.size());
+
+            const float3x4& m0{ palette[joints.x] };
+            const float3x4& m1{ palette[joints.y] };
+            const float3x4& m2{ palette[joints.z] };
+            const float3x4& m3{ palette[joints.w] };
+
+            float3x4 m;
+            for (int r{ 0 }; r < 3; ++r)
+                m.rows[r] = weights.x * m0.rows[r] + weights.y * m1.rows[r] +
+                            weights.z * m2.rows[r] + weights.w * m3.rows[r];
+            return m;
+        }
+
+        /**
+         * @brief Blends the four palette dual quaternions of one vertex (dual quaternion skinning).
+         *
+         * Influences whose rotation lies in the opposite hemisphere of the first one are
+         * negated so all four blend along the shortest path.
+         */
+        [[nodiscard]] CHLM_INLINE dual_quat blend_palette(const std::span<const dual_quat> palette,
+                                                          const uint4 joints, const float4 weights) noexcept
+        {
+            assert(joints.x < palette.size() && joints.y < palette.size() &&
+                   joints.z < palette.size() && joints.w < palette.size());
+
+            const dual_quat& d0{ palette[joints.x] };
+            const dual_quat& d1{ palette[joints.y] };
+            const dual_quat& d2{ palette[joints.z] };
+            const dual_quat& d3{ palette[joints.w] };
+
+            const float w1{ dot(d0.real, d1.real) < 0.f ? -weights.y : weights.y };
+            const float w2{ dot(d0.real, d2.real) < 0.f ? -weights.z : weights.z };
+            const float w3{ dot(d0.real, d3.real) < 0.f ? -weights.w : weights.w };
+
+            return normalize(dual_quat{
+                weights.x * d0.real + w1 * d1.real + w2 * d2.real + w3 * d3.real,
+                weights.x * d0.dual + w1 * d1.dual + w2 * d2.dual + w3 * d3.dual
+            });
+        }
+
+        /**
+         * @brief Shared kernel for skin_linear() / skin_dual_quat().
+         *
+         * @p normals and @p out_normals are either both null or both set.
+         */
+        template<typename Joint>
+        inline void skin(const std::span<const Joint> palette,
+                         const std::span<const uint4> joints, const std::span<const float4> weights,
+                         const float3_soa& positions, float3_soa& out_positions,
+                         const float3_soa* normals, float3_soa* out_normals)
+        {
+            const size_t count{ positions.size() };
+            assert(joints.size() >= count && weights.size() >= count);
+            assert((normals == nullptr) == (out_normals == nullptr));
+            assert(normals == nullptr || normals->size() == count);
+
+            out_positions.resize(count);
+            if (out_normals)
+                out_normals->resize(count);
+
+            const float* px{ positions.x().data() };
+            const float* py{ positions.y().data() };
+            const float* pz{ positions.z().data() };
+            float* out_px{ out_positions.x().data() };
+            float* out_py{ out_positions.y().data() };
+            float* out_pz{ out_positions.z().data() };
+
+            const float* nx{ normals ? normals->x().data() : nullptr };
+            const float* ny{ normals ? normals->y().data() : nullptr };
+            const float* nz{ normals ? normals->z().data() : nullptr };
+            float* out_nx{ out_normals ? out_normals->x().data() : nullptr };
+            float* out_ny{ out_normals ? out_normals->y().data() : nullptr };
+            float* out_nz{ out_normals ? out_normals->z().data() : nullptr };
+
+            dispatch([&]() CHLM_KERNEL
+            {
+                for (size_t i{ 0 }; i < count; ++i)
+                {
+                    const Joint m{ blend_palette(palette, joints[i], weights[i]) };
+
+                    const float3 p{ transform_point(m, float3{ px[i], py[i], pz[i] }) };
+                    out_px[i] = p.x;
+                    out_py[i] = p.y;
+                    out_pz[i] = p.z;
+
+                    if (nx)
+                    {
+                        const float3 n{ normalize(transform_vector(m, float3{ nx[i], ny[i], nz[i] })) };
+                        out_nx[i] = n.x;
+                        out_ny[i] = n.y;
+                        out_nz[i] = n.z;
+                    }
+                }
+            });
+        }
+    } // namespace detail
+
+    /**
+     * @brief Skins vertex positions by linear blending of a float3x4 palette.
+     *
+     * Each vertex is transformed by sum(weights[k] * palette[joints[k]]). Palette entries
+     * are usually world * inverse_bind per joint. Resizes @p out_positions to positions.size().
+     *
+     * @param palette       Skinning matrices.
+     * @param joints        Four palette indices per vertex (at least positions.size() elements).
+     * @param weights       Four weights per vertex, matching @p joints.
+     * @param positions     Bind-pose positions.
+     * @param out_positions Skinned positions (may be the same container as @p positions).
+     */
+    inline void skin_linear(const std::span<const float3x4> palette,
+                            const std::span<const uint4> joints, const std::span<const float4> weights,
+                            const float3_soa& positions, float3_soa& out_positions)
+    {
+        detail::skin(palette, joints, weights, positions, out_positions, nullptr, nullptr);
+    }
+
+    /**
+     * @brief Skins vertex positions and normals by linear blending of a float3x4 palette.
+     *
+     * Normals are transformed by the blended linear part and renormalized (exact for
+     * rigid and uniformly scaled joints).
+     *
+     * @param palette       Skinning matrices.
+     * @param joints        Four palette indices per vertex (at least positions.size() elements).
+     * @param weights       Four weights per vertex, matching @p joints.
+     * @param positions     Bind-pose positions.
+     * @param normals       Bind-pose unit normals (same size as @p positions).
+     * @param out_positions Skinned positions (may be the same container as @p positions).
+     * @param out_normals   Skinned unit normals (may be the same container as @p normals).
+     */
+    inline void skin_linear(const std::span<const float3x4> palette,
+                            const std::span<const uint4> joints, const std::span<const float4> weights,
+                            const float3_soa& positions, const float3_soa& normals,
+                            float3_soa& out_positions, float3_soa& out_normals)
+    {
+        detail::skin(palette, joints, weights, positions, out_positions, &normals, &out_normals);
+    }
+
+    /**
+     * @brief Skins vertex positions with dual quaternion blending.
+     *
+     * Each vertex is transformed by the normalized, hemisphere-corrected weighted sum of
+     * its four palette dual quaternions. Unlike skin_linear(), twisting joints keep their
+     * volume. Resizes @p out_positions to positions.size().
+     *
+     * @param palette       Rigid skinning transforms (world * inverse_bind per joint).
+     * @param joints        Four palette indices per vertex (at least positions.size() elements).
+     * @param weights       Four weights per vertex, matching @p joints.
+     * @param positions     Bind-pose positions.
+     * @param out_positions Skinned positions (may be the same container as @p positions).
+     */
+    inline void skin_dual_quat(const std::span<const dual_quat> palette,
+                               const std::span<const uint4> joints, const std::span<const float4> weights,
+                               const float3_soa& positions, float3_soa& out_positions)
+    {
+        detail::skin(palette, joints, weights, positions, out_positions, nullptr, nullptr);
+    }
+
+    /**
+     * @brief Skins vertex positions and normals with dual quaternion blending.
+     *
+     * @param palette       Rigid skinning transforms (world * inverse_bind per joint).
+     * @param joints        Four palette indices per vertex (at least positions.size() elements).
+     * @param weights       Four weights per vertex, matching @p joints.
+     * @param positions     Bind-pose positions.
+     * @param normals       Bind-pose unit normals (same size as @p positions).
+     * @param out_positions Skinned positions (may be the same container as @p positions).
+     * @param out_normals   Skinned unit normals (may be the same container as @p normals).
+     */
+    inline void skin_dual_quat(const std::span<const dual_quat> palette,
+                               const std::span<const uint4> joints, const std::span<const float4> weights,
+                               const float3_soa& positions, const float3_soa& normals,
+                               float3_soa& out_positions, float3_soa& out_normals)
+    {
+        detail::skin(palette, joints, weights, positions, out_positions, &normals, &out_normals);
+    }
+} // namespace chlm
@@ -0,0 +1,491 @@
+//
+// Created by Zack Shrout on 10/16/26.
+// Copyright (c) 2026 BunnySoft. All rights reserved.
+//
+
+#pragma once
+
+#include "Core.h"
+#include "Dispatch.h"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace chlm {
+    // ========================================
+    // Structure-of-arrays containers
+    // ========================================
+    // float3 and float4 are stored one component per array, so a float3 costs
+    // 12 bytes instead of 16 and wide kernels can load eight or sixteen X values
+    // at once. Every component array is 64-byte aligned and padded to a multiple
+    // of 16 floats, so float8 / float16 loops can run past size() up to
+    // padded_size() without a scalar tail. Padding lanes are readable and writable
+    // but hold unspecified values.
+
+    namespace detail {
+        constexpr size_t soa_alignment{ 64 };
+        constexpr size_t soa_lanes{ 16 };
+
+        /**
+         * @brief Minimal allocator returning storage aligned to @p Alignment bytes.
+         */
+        template<typename T, size_t Alignment>
+        struct aligned_allocator
+        {
+            using value_type = T;
+
+            template<typename U>
+            struct rebind
+            {
+                using other = aligned_allocator<U, Alignment>;
+            };
+
+            constexpr aligned_allocator() noexcept = default;
+
+            template<typename U>
+            constexpr aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept { }
+
+            [[nodiscard]] T* allocate(const size_t n)
+            {
+                return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ Alignment }));
+            }
+
+            void deallocate(T* ptr, const size_t) noexcept
+            {
+                ::operator delete(ptr, std::align_val_t{ Alignment });
+            }
+
+            template<typename U>
+            constexpr bool operator==(const aligned_allocator<U, Alignment>&) const noexcept { return true; }
+        };
+
+        using soa_column = std::vector<float, aligned_allocator<float, soa_alignment>>;
+
+        /**
+         * @brief Rounds an element count up to the SoA lane padding.
+         */
+        [[nodiscard]] constexpr size_t soa_padded(const size_t n) noexcept
+        {
+            return (n + soa_lanes - 1) & ~(soa_lanes - 1);
+        }
+    } // namespace detail
+
+    /**
+     * @brief Proxy to one element of a float3_soa, exposing .x/.y/.z like a float3.
+     *
+     * Converts to float3 and accepts float3 assignment, so `soa[i] = soa[i] * 2.f`
+     * style code reads the same as with a std::vector<float3>.
+     *
+     * @tparam F `float` for mutable access, `const float` for read-only access.
+     */
+    template<typename F>
+    struct float3_ref
+    {
+        F& x;
+        F& y;
+        F& z;
+
+        operator float3() const noexcept { return float3{ x, y, z }; }
+
+        const float3_ref& operator=(const float3 v) const noexcept requires (!std::is_const_v<F>)
+        {
+            x = v.x;
+            y = v.y;
+            z = v.z;
+            return *this;
+        }
+
+        const float3_ref& operator=(const float3_ref& other) const noexcept requires (!std::is_const_v<F>)
+        {
+            return *this = static_cast<float3>(other);
+        }
+    };
+
+    /**
+     * @brief Proxy to one element of a float4_soa, exposing .x/.y/.z/.w like a float4.
+     *
+     * @tparam F `float` for mutable access, `const float` for read-only access.
+     */
+    template<typename F>
+    struct float4_ref
+    {
+        F& x;
+        F& y;
+        F& z;
+        F& w;
+
+        operator float4() const noexcept { return float4{ x, y, z, w }; }
+
+        const float4_ref& operator=(const float4 v) const noexcept requires (!std::is_const_v<F>)
+        {
+            x = v.x;
+            y = v.y;
+            z = v.z;
+            w = v.w;
+            return *this;
+        }
+
+        const float4_ref& operator=(const float4_ref& other) const noexcept requires (!std::is_const_v<F>)
+        {
+            return *this = static_cast<float4>(other);
+        }
+    };
+
+    /**
+     * @brief Random-access iterator over an SoA container, yielding element proxies.
+     */
+    template<typename Container, typename Reference>
+    struct soa_iterator
+    {
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename std::remove_const_t<Container>::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = Reference;
+
+        Container* container{ nullptr };
+        size_t index{ 0 };
+
+        Reference operator*() const noexcept { return (*container)[index]; }
+        Reference operator[](const difference_type n) const noexcept { return (*container)[index + n]; }
+
+        soa_iterator& operator++() noexcept { ++index; return *this; }
+        soa_iterator operator++(int) noexcept { soa_iterator it{ *this }; ++index; return it; }
+        soa_iterator& operator--() noexcept { --index; return *this; }
+        soa_iterator operator--(int) noexcept { soa_iterator it{ *this }; --index; return it; }
+        soa_iterator& operator+=(const difference_type n) noexcept { index += n; return *this; }
+        soa_iterator& operator-=(const difference_type n) noexcept { index -= n; return *this; }
+
+        friend soa_iterator operator+(soa_iterator it, const difference_type n) noexcept { return it += n; }
+        friend soa_iterator operator+(const difference_type n, soa_iterator it) noexcept { return it += n; }
+        friend soa_iterator operator-(soa_iterator it, const difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(const soa_iterator& a, const soa_iterator& b) noexcept
+        {
+            return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+        }
+
+        friend bool operator==(const soa_iterator& a, const soa_iterator& b) noexcept { return a.index == b.index; }
+        friend auto operator<=>(const soa_iterator& a, const soa_iterator& b) noexcept { return a.index <=> b.index; }
+    };
+
+    /**
+     * @brief Aligned structure-of-arrays storage for N-component float vectors.
+     *
+     * Use the float3_soa / float4_soa / quat_soa aliases. Component arrays are exposed as
+     * spans through x(), y(), z() and w() for direct use with span-based batch kernels.
+     *
+     * @tparam N Number of components (3 or 4).
+     */
+    template<size_t N>
+    class basic_float_soa
+    {
+        static_assert(N == 3 || N == 4, "basic_float_soa supports 3 or 4 components");
+
+    public:
+        using value_type = std::conditional_t<N == 3, float3, float4>;
+        using reference = std::conditional_t<N == 3, float3_ref<float>, float4_ref<float>>;
+        using const_reference = std::conditional_t<N == 3, float3_ref<const float>, float4_ref<const float>>;
+        using iterator = soa_iterator<basic_float_soa, reference>;
+        using const_iterator = soa_iterator<const basic_float_soa, const_reference>;
+
+        basic_float_soa() = default;
+
+        /**
+         * @brief Creates a container with @p count zero-initialized elements.
+         */
+        explicit basic_float_soa(const size_t count) { resize(count); }
+
+        /**
+         * @brief Number of logical elements.
+         */
+        [[nodiscard]] size_t size() const noexcept { return size_; }
+
+        /**
+         * @brief Number of elements each component array can be read/written up to (multiple of 16).
+         */
+        [[nodiscard]] size_t padded_size() const noexcept { return detail::soa_padded(size_); }
+
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+        /**
+         * @brief Resizes all component arrays. New elements are zero-initialized.
+         */
+        void resize(const size_t count)
+        {
+            for (detail::soa_column& column : columns_)
+            {
+                column.resize(detail::soa_padded(count), 0.f);
+
+                // Lanes reused from the previous padding may hold stale values
+                if (count > size_)
+                    std::fill(column.begin() + static_cast<std::ptrdiff_t>(size_),
+                              column.begin() + static_cast<std::ptrdiff_t>(count), 0.f);
+            }
+            size_ = count;
+        }
+
+        /**
+         * @brief Reserves capacity for @p count elements in every component array.
+         */
+        void reserve(const size_t count)
+        {
+            for (detail::soa_column& column : columns_)
+                column.reserve(detail::soa_padded(count));
+        }
+
+        void clear() noexcept
+        {
+            for (detail::soa_column& column : columns_)
+                column.clear();
+            size_ = 0;
+        }
+
+        /**
+         * @brief Appends an element, scattering its components into the component arrays.
+         */
+        void push_back(const value_type v)
+        {
+            if (size_ == padded_size())
+                resize(size_ + 1);
+            else
+                ++size_;
+
+            (*this)[size_ - 1] = v;
+        }
+
+        reference operator[](const size_t i) noexcept
+        {
+            assert(i < size_);
+            if constexpr (N == 3)
+                return reference{ columns_[0][i], columns_[1][i], columns_[2][i] };
+            else
+                return reference{ columns_[0][i], columns_[1][i], columns_[2][i], columns_[3][i] };
+        }
+
+        const_reference operator[](const size_t i) const noexcept
+        {
+            assert(i < size_);
+            if constexpr (N == 3)
+                return const_reference{ columns_[0][i], columns_[1][i], columns_[2][i] };
+            else
+                return const_reference{ columns_[0][i], columns_[1][i], columns_[2][i], columns_[3][i] };
+        }
+
+        /**
+         * @brief Returns component array @p c (0 = x, 1 = y, ...) limited to size() elements.
+         */
+        [[nodiscard]] std::span<float> component(const size_t c) noexcept
+        {
+            assert(c < N);
+            return { columns_[c].data(), size_ };
+        }
+
+        /**
+         * @brief Returns component array @p c (0 = x, 1 = y, ...) limited to size() elements.
+         */
+        [[nodiscard]] std::span<const float> component(const size_t c) const noexcept
+        {
+            assert(c < N);
+            return { columns_[c].data(), size_ };
+        }
+
+        [[nodiscard]] std::span<float> x() noexcept { return component(0); }
+        [[nodiscard]] std::span<float> y() noexcept { return component(1); }
+        [[nodiscard]] std::span<float> z() noexcept { return component(2); }
+        [[nodiscard]] std::span<float> w() noexcept requires (N == 4) { return component(3); }
+
+        [[nodiscard]] std::span<const float> x() const noexcept { return component(0); }
+        [[nodiscard]] std::span<const float> y() const noexcept { return component(1); }
+        [[nodiscard]] std::span<const float> z() const noexcept { return component(2); }
+        [[nodiscard]] std::span<const float> w() const noexcept requires (N == 4) { return component(3); }
+
+        iterator begin() noexcept { return { this, 0 }; }
+        iterator end() noexcept { return { this, size_ }; }
+        const_iterator begin() const noexcept { return { this, 0 }; }
+        const_iterator end() const noexcept { return { this, size_ }; }
+
+    private:
+        std::array<detail::soa_column, N> columns_{ };
+        size_t size_{ 0 };
+    };
+
+    using float3_soa = basic_float_soa<3>;
+    using float4_soa = basic_float_soa<4>;
+
+    /**
+     * @brief SoA quaternion storage (x, y, z, w arrays); quat is a float4.
+     */
+    using quat_soa = float4_soa;
+
+    static_assert(std::random_access_iterator<float3_soa::iterator>);
+    static_assert(std::random_access_iterator<float3_soa::const_iterator>);
+    static_assert(std::random_access_iterator<float4_soa::iterator>);
+    static_assert(std::random_access_iterator<float4_soa::const_iterator>);
+
+    // ========================================
+    // AoS <-> SoA conversion
+    // ========================================
+
+    /**
+     * @brief Converts an array of float3 into SoA form. Resizes @p out to in.size().
+     *
+     * Four elements per iteration are transposed in registers.
+     *
+     * @param in  Source vectors.
+     * @param out Destination container.
+     */
+    inline void to_soa(const std::span<const float3> in, float3_soa& out)
+    {
+        out.resize(in.size());
+        float* xs{ out.x().data() };
+        float* ys{ out.y().data() };
+        float* zs{ out.z().data() };
+        const size_t count{ in.size() };
+
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            size_t i{ 0 };
+            for (; i + 4 <= count; i += 4)
+            {
+                // float3 occupies a 16-byte slot; the fourth lane is ignored
+                float4 a{ in[i + 0].x, in[i + 0].y, in[i + 0].z, 0.f };
+                float4 b{ in[i + 1].x, in[i + 1].y, in[i + 1].z, 0.f };
+                float4 c{ in[i + 2].x, in[i + 2].y, in[i + 2].z, 0.f };
+                float4 d{ in[i + 3].x, in[i + 3].y, in[i + 3].z, 0.f };
+                detail::transpose4(a, b, c, d);
+
+                detail::store(xs + i, a, store_hint::cached);
+                detail::store(ys + i, b, store_hint::cached);
+                detail::store(zs + i, c, store_hint::cached);
+            }
+
+            for (; i < count; ++i)
+            {
+                xs[i] = in[i].x;
+                ys[i] = in[i].y;
+                zs[i] = in[i].z;
+            }
+        });
+    }
+
+    /**
+     * @brief Converts an array of float4 into SoA form. Resizes @p out to in.size().
+     *
+     * @param in  Source vectors.
+     * @param out Destination container.
+     */
+    inline void to_soa(const std::span<const float4> in, float4_soa& out)
+    {
+        out.resize(in.size());
+        float* xs{ out.x().data() };
+        float* ys{ out.y().data() };
+        float* zs{ out.z().data() };
+        float* ws{ out.w().data() };
+        const size_t count{ in.size() };
+
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            size_t i{ 0 };
+            for (; i + 4 <= count; i += 4)
+            {
+                float4 a{ in[i + 0] };
+                float4 b{ in[i + 1] };
+                float4 c{ in[i + 2] };
+                float4 d{ in[i + 3] };
+                detail::transpose4(a, b, c, d);
+
+                detail::store(xs + i, a, store_hint::cached);
+                detail::store(ys + i, b, store_hint::cached);
+                detail::store(zs + i, c, store_hint::cached);
+                detail::store(ws + i, d, store_hint::cached);
+            }
+
+            for (; i < count; ++i)
+            {
+                xs[i] = in[i].x;
+                ys[i] = in[i].y;
+                zs[i] = in[i].z;
+                ws[i] = in[i].w;
+            }
+        });
+    }
+
+    /**
+     * @brief Converts SoA vectors back into an array of float3.
+     *
+     * @param in  Source container.
+     * @param out Destination (at least in.size() elements).
+     */
+    inline void to_aos(const float3_soa& in, const std::span<float3> out) noexcept
+    {
+        assert(out.size() >= in.size());
+
+        const float* xs{ in.x().data() };
+        const float* ys{ in.y().data() };
+        const float* zs{ in.z().data() };
+        const size_t count{ in.size() };
+
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            size_t i{ 0 };
+            for (; i + 4 <= count; i += 4)
+            {
+                float4 a{ detail::load<float4>(xs + i) };
+                float4 b{ detail::load<float4>(ys + i) };
+                float4 c{ detail::load<float4>(zs + i) };
+                float4 d{ float4_zero };
+                detail::transpose4(a, b, c, d);
+
+                out[i + 0] = a.xyz;
+                out[i + 1] = b.xyz;
+                out[i + 2] = c.xyz;
+                out[i + 3] = d.xyz;
+            }
+
+            for (; i < count; ++i)
+                out[i] = float3{ xs[i], ys[i], zs[i] };
+        });
+    }
+
+    /**
+     * @brief Converts SoA vectors back into an array of float4.
+     *
+     * @param in  Source container.
+     * @param out Destination (at least in.size() elements).
+     */
+    inline void to_aos(const float4_soa& in, const std::span<float4> out) noexcept
+    {
+        assert(out.size() >= in.size());
+
+        const float* xs{ in.x().data() };
+        const float* ys{ in.y().data() };
+        const float* zs{ in.z().data() };
+        const float* ws{ in.w().data() };
+        const size_t count{ in.size() };
+
+        detail::dispatch([&]() CHLM_KERNEL
+        {
+            size_t i{ 0 };
+            for (; i + 4 <= count; i += 4)
+            {
+                float4 a{ detail::load<float4>(xs + i) };
+                float4 b{ detail::load<float4>(ys + i) };
+                float4 c{ detail::load<float4>(zs + i) };
+                float4 d{ detail::load<float4>(ws + i) };
+                detail::transpose4(a, b, c, d);
+
+                out[i + 0] = a;
+                out[i + 1] = b;
+                out[i + 2] = c;
+                out[i + 3] = d;
+            }
+
+            for (; i < count; ++i)
+                out[i] = float4{ xs[i], ys[i], zs[i], ws[i] };
+        });
+    }
+} // namespace chlm
@@ -0,0 +1,169 @@
+//
+// Created by Zack Shrout on 10/16/26.
+// Copyright (c) 2026 BunnySoft. All rights reserved.
+//
+
+#pragma once
+
+#include "Core.h"
+#include "Matrix4x4.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace chlm {
+    // ========================================
+    // Transform hierarchy (local -> world propagation)
+    // ========================================
+
+    /**
+     * @brief Flat scene-graph transform storage with dirty tracking.
+     *
+     * Nodes are stored in topological order: every node's parent has a smaller index
+     * (roots use -1). update_world_transforms() groups nodes by depth, so all nodes of a
+     * level are independent and can be multiplied in parallel, and skips every node
+     * whose own local matrix and ancestors are unchanged.
+     *
+     * Fill `parents` / `locals` directly (then call build_levels()) or use add_node().
+     * After the first update, change locals through set_local() so dirty flags stay correct.
+     */
+    struct transform_hierarchy
+    {
+        std::vector<int32_t> parents;        // parent index per node, -1 for roots
+        std::vector<float4x4> locals;        // parent-relative transforms
+        std::vector<float4x4> worlds;        // results of update_world_transforms()
+        std::vector<uint8_t> dirty;          // non-zero when the local changed since the last update
+
+        std::vector<uint32_t> level_starts;  // level_nodes offsets per depth (levels + 1 entries)
+        std::vector<uint32_t> level_nodes;   // node indices grouped by depth
+    };
+
+    /**
+     * @brief Groups nodes by depth and sizes the world/dirty arrays.
+     *
+     * Marks every node dirty. Called automatically by update_world_transforms()
+     * when nodes were added since the last build.
+     *
+     * @param h Hierarchy whose `parents` array is topologically sorted.
+     */
+    inline void build_levels(transform_hierarchy& h)
+    {
+        const size_t count{ h.parents.size() };
+        assert(h.locals.size() == count);
+
+        std::vector<uint32_t> depth(count);
+        uint32_t max_depth{ 0 };
+        for (size_t i{ 0 }; i < count; ++i)
+        {
+            const int32_t parent{ h.parents[i] };
+            assert(parent < static_cast<int32_t>(i) && "parents must precede their children");
+            depth[i] = parent < 0 ? 0 : depth[parent] + 1;
+            max_depth = max(max_depth, depth[i]);
+        }
+
+        // Counting sort by depth keeps the original (cache-friendly) order within each level
+        h.level_starts.assign(count ? max_depth + 2 : 1, 0);
+        for (size_t i{ 0 }; i < count; ++i)
+            ++h.level_starts[depth[i] + 1];
+        for (size_t d{ 1 }; d < h.level_starts.size(); ++d)
+            h.level_starts[d] += h.level_starts[d - 1];
+
+        h.level_nodes.resize(count);
+        std::vector<uint32_t> cursor(h.level_starts.begin(), h.level_starts.end() - 1);
+        for (size_t i{ 0 }; i < count; ++i)
+            h.level_nodes[cursor[depth[i]]++] = static_cast<uint32_t>(i);
+
+        h.worlds.resize(count);
+        h.dirty.assign(count, 1);
+    }
+
+    /**
+     * @brief Appends a node to the hierarchy.
+     *
+     * @param h      Hierarchy to extend.
+     * @param parent Index of an existing node, or -1 for a root.
+     * @param local  Parent-relative transform.
+     * @return Index of the new node.
+     */
+    inline uint32_t add_node(transform_hierarchy& h, const int32_t parent, const float4x4& local)
+    {
+        assert(parent < static_cast<int32_t>(h.parents.size()));
+
+        h.parents.push_back(parent);
+        h.locals.push_back(local);
+        h.worlds.push_back(local);
+        h.dirty.push_back(1);
+        return static_cast<uint32_t>(h.parents.size() - 1);
+    }
+
+    /**
+     * @brief Replaces a node's local transform and marks it (and thereby its subtree) dirty.
+     *
+     * @param h     Hierarchy to modify.
+     * @param node  Node index.
+     * @param local New parent-relative transform.
+     */
+    inline void set_local(transform_hierarchy& h, const uint32_t node, const float4x4& local) noexcept
+    {
+        assert(node < h.locals.size());
+
+        h.locals[node] = local;
+        h.dirty[node] = 1;
+    }
+
+    /**
+     * @brief Recomputes world matrices for every dirty node and its descendants.
+     *
+     * Processes one depth level at a time: world = parent_world * local. A node is
+     * recomputed when it or its parent was dirty, and it then counts as dirty for its own
+     * children, so clean subtrees cost one flag test per node. All flags are cleared on return.
+     *
+     * @param h        Hierarchy to update.
+     * @param parallel Split large levels across threads with parallel_for().
+     */
+    inline void update_world_transforms(transform_hierarchy& h, const bool parallel = false)
+    {
+        if (h.level_nodes.size() != h.parents.size())
+            build_levels(h);
+
+        const int32_t* parents{ h.parents.data() };
+        const float4x4* locals{ h.locals.data() };
+        float4x4* worlds{ h.worlds.data() };
+        uint8_t* dirty{ h.dirty.data() };
+        const uint32_t* nodes{ h.level_nodes.data() };
+
+        const auto update_range{ [&](const size_t begin, const size_t end)
+        {
+            for (size_t n{ begin }; n < end; ++n)
+            {
+                const uint32_t i{ nodes[n] };
+                const int32_t parent{ parents[i] };
+
+                if (parent < 0)
+                {
+                    if (dirty[i]) worlds[i] = locals[i];
+                }
+                else if (dirty[i] || dirty[parent])
+                {
+                    worlds[i] = mul(worlds[parent], locals[i]);
+                    dirty[i] = 1;
+                }
+            }
+        } };
+
+        constexpr size_t min_chunk{ 2048 };
+        for (size_t level{ 0 }; level + 1 < h.level_starts.size(); ++level)
+        {
+            const size_t begin{ h.level_starts[level] };
+            const size_t end{ h.level_starts[level + 1] };
+
+            if (parallel && end - begin >= 2 * min_chunk)
+                parallel_for(end - begin, min_chunk, [&](const size_t b, const size_t e) { update_range(begin + b, begin + e); });
+            else
+                update_range(begin, end);
+        }
+
+        std::fill(h.dirty.begin(), h.dirty.end(), uint8_t{ 0 });
+    }
+} // namespace chlm
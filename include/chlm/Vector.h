@@ -6,8 +6,138 @@
 #pragma once
 
 #include "Core.h"
+#include "Dispatch.h"
+
+#include <span>
 
 namespace chlm {
+    // ========================================
+    // Horizontal reductions
+    // ========================================
+    // Built from __builtin_shufflevector so the whole reduction stays in one
+    // register (shuffle + op, twice) instead of extracting lanes one by one.
+    // The *_splat variants leave the result in every lane for chained SIMD math.
+
+    /**
+     * @brief Sums all components of a vector, broadcasting the result to every lane.
+     *
+     * @param v Input vector.
+     * @return {s, s, s, s} where s = v.x + v.y + v.z + v.w.
+     */
+    constexpr float4 hsum_splat(const float4 v) noexcept
+    {
+        const float4 t{ v + __builtin_shufflevector(v, v, 1, 0, 3, 2) };
+        return t + __builtin_shufflevector(t, t, 2, 3, 0, 1);
+    }
+
+    /**
+     * @brief Returns the smallest component of a vector, broadcast to every lane.
+     *
+     * @param v Input vector.
+     * @return {m, m, m, m} where m is the minimum component.
+     */
+    constexpr float4 hmin_splat(const float4 v) noexcept
+    {
+        const float4 t{ __builtin_elementwise_min(v, __builtin_shufflevector(v, v, 1, 0, 3, 2)) };
+        return __builtin_elementwise_min(t, __builtin_shufflevector(t, t, 2, 3, 0, 1));
+    }
+
+    /**
+     * @brief Returns the largest component of a vector, broadcast to every lane.
+     *
+     * @param v Input vector.
+     * @return {m, m, m, m} where m is the maximum component.
+     */
+    constexpr float4 hmax_splat(const float4 v) noexcept
+    {
+        const float4 t{ __builtin_elementwise_max(v, __builtin_shufflevector(v, v, 1, 0, 3, 2)) };
+        return __builtin_elementwise_max(t, __builtin_shufflevector(t, t, 2, 3, 0, 1));
+    }
+
+    /**
+     * @brief Sums all components of a vector.
+     *
+     * @param v Input vector.
+     * @return v.x + v.y + v.z.
+     */
+    constexpr float hsum(const float3 v) noexcept
+    {
+        // Pad the fourth lane with 0 (lane 3 selects the first element of the zero vector)
+        return hsum_splat(__builtin_shufflevector(v, float3_zero, 0, 1, 2, 3)).x;
+    }
+
+    /**
+     * @brief Sums all components of a vector.
+     *
+     * @param v Input vector.
+     * @return v.x + v.y + v.z + v.w.
+     */
+    constexpr float hsum(const float4 v) noexcept { return hsum_splat(v).x; }
+
+    /**
+     * @brief Sums all components of a vector.
+     *
+     * @param v Input vector.
+     * @return Sum of all eight lanes.
+     */
+    constexpr float hsum(const float8 v) noexcept { return hsum(v.lo + v.hi); }
+
+    /**
+     * @brief Sums all components of a vector.
+     *
+     * @param v Input vector.
+     * @return Sum of all sixteen lanes.
+     */
+    constexpr float hsum(const float16 v) noexcept { return hsum(v.lo + v.hi); }
+
+    /**
+     * @brief Returns the smallest component of a vector.
+     *
+     * @param v Input vector.
+     * @return min(v.x, v.y, v.z).
+     */
+    constexpr float hmin(const float3 v) noexcept { return hmin_splat(__builtin_shufflevector(v, v, 0, 1, 2, 0)).x; }
+
+    /**
+     * @brief Returns the smallest component of a vector.
+     *
+     * @param v Input vector.
+     * @return min(v.x, v.y, v.z, v.w).
+     */
+    constexpr float hmin(const float4 v) noexcept { return hmin_splat(v).x; }
+
+    /**
+     * @brief Returns the smallest component of a vector.
+     *
+     * @param v Input vector.
+     * @return Minimum of all eight lanes.
+     */
+    constexpr float hmin(const float8 v) noexcept { return hmin(__builtin_elementwise_min(v.lo, v.hi)); }
+
+    /**
+     * @brief Returns the largest component of a vector.
+     *
+     * @param v Input vector.
+     * @return max(v.x, v.y, v.z).
+     */
+    constexpr float hmax(const float3 v) noexcept { return hmax_splat(__builtin_shufflevector(v, v, 0, 1, 2, 0)).x; }
+
+    /**
+     * @brief Returns the largest component of a vector.
+     *
+     * @param v Input vector.
+     * @return max(v.x, v.y, v.z, v.w).
+     */
+    constexpr float hmax(const float4 v) noexcept { return hmax_splat(v).x; }
+
+    /**
+     * @brief Returns the largest component of a vector.
+     *
+     * @param v Input vector.
+     * @return Maximum of all eight lanes.
+     */
+    constexpr float hmax(const float8 v) noexcept { return hmax(__builtin_elementwise_max(v.lo, v.hi)); }
+
     // ========================================
     // Core vector functions
     // ========================================
@@ -28,7 +158,25 @@ namespace chlm {
      * @param b Second vector.
      * @return The dot product a · b.
      */
-    constexpr float dot(const float3 a, const float3 b) noexcept { return (a * b).x + (a * b).y + (a * b).z; }
+    constexpr float dot(const float3 a, const float3 b) noexcept { return hsum(a * b); }
+
+    /**
+     * @brief Computes the dot (scalar) product of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return The dot product a · b.
+     */
+    constexpr float dot(const float4 a, const float4 b) noexcept { return hsum(a * b); }
+
+    /**
+     * @brief Computes the dot (scalar) product of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return The dot product a · b.
+     */
+    constexpr float dot(const float8 a, const float8 b) noexcept { return hsum(a * b); }
 
     /**
      * @brief Computes the dot (scalar) product of two vectors.
@@ -37,7 +185,34 @@ namespace chlm {
      * @param b Second vector.
      * @return The dot product a · b.
      */
-    constexpr float dot(const float4 a, const float4 b) noexcept { return (a * b).x + (a * b).y + (a * b).z + (a * b).w; }
+    constexpr float dot(const float16 a, const float16 b) noexcept { return hsum(a * b); }
+
+    /**
+     * @brief Computes the dot product of two vectors, broadcast to every lane.
+     *
+     * Keeps the result in a vector register so it can scale or compare against
+     * other vectors without a scalar round-trip.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return {d, d, d, d} where d = a · b.
+     */
+    constexpr float4 dot_splat(const float3 a, const float3 b) noexcept
+    {
+        return hsum_splat(__builtin_shufflevector(a * b, float3_zero, 0, 1, 2, 3));
+    }
+
+    /**
+     * @brief Computes the dot product of two vectors, broadcast to every lane.
+     *
+     * Keeps the result in a vector register so it can scale or compare against
+     * other vectors without a scalar round-trip.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return {d, d, d, d} where d = a · b.
+     */
+    constexpr float4 dot_splat(const float4 a, const float4 b) noexcept { return hsum_splat(a * b); }
 
     /**
      * @brief Computes the squared length (magnitude) of a vector.
@@ -72,6 +247,28 @@ namespace chlm {
      */
     constexpr float length_squared(const float4 v) noexcept { return dot(v, v); }
 
+    /**
+     * @brief Computes the squared length (magnitude) of a vector.
+     *
+     * Equivalent to dot(v, v) but often preferred when only comparing lengths
+     * or avoiding a costly square root.
+     *
+     * @param v The vector.
+     * @return The squared length ||v||².
+     */
+    constexpr float length_squared(const float8 v) noexcept { return dot(v, v); }
+
+    /**
+     * @brief Computes the squared length (magnitude) of a vector.
+     *
+     * Equivalent to dot(v, v) but often preferred when only comparing lengths
+     * or avoiding a costly square root.
+     *
+     * @param v The vector.
+     * @return The squared length ||v||².
+     */
+    constexpr float length_squared(const float16 v) noexcept { return dot(v, v); }
+
     /**
      * Computes the length (magnitude) of a vector.
      *
@@ -96,6 +293,22 @@ namespace chlm {
      */
     constexpr float length(const float4 v) noexcept { return sqrt(length_squared(v)); }
 
+    /**
+     * Computes the length (magnitude) of a vector.
+     *
+     * @param v The vector.
+     * @return The length ||v||.
+     */
+    constexpr float length(const float8 v) noexcept { return sqrt(length_squared(v)); }
+
+    /**
+     * Computes the length (magnitude) of a vector.
+     *
+     * @param v The vector.
+     * @return The length ||v||.
+     */
+    constexpr float length(const float16 v) noexcept { return sqrt(length_squared(v)); }
+
     /**
      * @brief Normalizes a vector to unit length.
      *
@@ -138,6 +351,112 @@ namespace chlm {
         return !almost_equal(len, .0f) ? v * (1.f / len) : float4{ .0f, .0f, .0f, .0f };
     }
 
+    /**
+     * @brief Normalizes a vector to unit length.
+     *
+     * If the vector is zero-length, returns a zero vector to avoid division by zero.
+     *
+     * @param v The vector to normalize.
+     * @return The normalized vector (length 1) or zero vector if input was zero.
+     */
+    constexpr float8 normalize(const float8 v) noexcept
+    {
+        const float len{ length(v) };
+        return !almost_equal(len, .0f) ? v * (1.f / len) : float8{ };
+    }
+
+    /**
+     * @brief Normalizes a vector to unit length.
+     *
+     * If the vector is zero-length, returns a zero vector to avoid division by zero.
+     *
+     * @param v The vector to normalize.
+     * @return The normalized vector (length 1) or zero vector if input was zero.
+     */
+    constexpr float16 normalize(const float16 v) noexcept
+    {
+        const float len{ length(v) };
+        return !almost_equal(len, .0f) ? v * (1.f / len) : float16{ };
+    }
+
+    /**
+     * @brief Normalizes a vector using the approximate reciprocal square root.
+     *
+     * Relative error <= 4e-7 versus normalize() (see rsqrt()). Zero-length
+     * vectors still return a zero vector, selected without a branch.
+     *
+     * @param v The vector to normalize.
+     * @return The normalized vector or zero vector if input was zero.
+     */
+    inline float2 normalize_fast(const float2 v) noexcept
+    {
+        const float len_sq{ length_squared(v) };
+        return len_sq > epsilon * epsilon ? v * rsqrt(len_sq) : float2{ .0f, .0f };
+    }
+
+    /**
+     * @brief Normalizes a vector using the approximate reciprocal square root.
+     *
+     * Relative error <= 4e-7 versus normalize() (see rsqrt()). Zero-length
+     * vectors still return a zero vector, selected without a branch.
+     *
+     * @param v The vector to normalize.
+     * @return The normalized vector or zero vector if input was zero.
+     */
+    inline float3 normalize_fast(const float3 v) noexcept
+    {
+        const float len_sq{ length_squared(v) };
+        return len_sq > epsilon * epsilon ? v * rsqrt(len_sq) : float3{ .0f, .0f, .0f };
+    }
+
+    /**
+     * @brief Normalizes a vector using the approximate reciprocal square root.
+     *
+     * Relative error <= 4e-7 versus normalize() (see rsqrt()). Zero-length
+     * vectors still return a zero vector, selected without a branch.
+     *
+     * @param v The vector to normalize.
+     * @return The normalized vector or zero vector if input was zero.
+     */
+    inline float4 normalize_fast(const float4 v) noexcept
+    {
+        const float len_sq{ length_squared(v) };
+        return len_sq > epsilon * epsilon ? v * rsqrt(len_sq) : float4{ .0f, .0f, .0f, .0f };
+    }
+
+    /**
+     * @brief Normalizes a vector using the approximate reciprocal square root, without a zero check.
+     *
+     * Same accuracy as normalize_fast(). The caller guarantees a non-zero input;
+     * zero-length vectors produce NaN components.
+     *
+     * @param v The non-zero vector to normalize.
+     * @return The normalized vector.
+     */
+    inline float2 normalize_unsafe(const float2 v) noexcept { return v * rsqrt(length_squared(v)); }
+
+    /**
+     * @brief Normalizes a vector using the approximate reciprocal square root, without a zero check.
+     *
+     * Same accuracy as normalize_fast(). The caller guarantees a non-zero input;
+     * zero-length vectors produce NaN components.
+     *
+     * @param v The non-zero vector to normalize.
+     * @return The normalized vector.
+     */
+    inline float3 normalize_unsafe(const float3 v) noexcept { return v * rsqrt(dot_splat(v, v)).xyz; }
+
+    /**
+     * @brief Normalizes a vector using the approximate reciprocal square root, without a zero check.
+     *
+     * Same accuracy as normalize_fast(). The caller guarantees a non-zero input;
+     * zero-length vectors produce NaN components.
+     *
+     * @param v The non-zero vector to normalize.
+     * @return The normalized vector.
+     */
+    inline float4 normalize_unsafe(const float4 v) noexcept { return v * rsqrt(dot_splat(v, v)); }
+
     /**
      * @brief Computes the cross product of two 3D vectors.
      *
@@ -191,4 +510,474 @@ namespace chlm {
      * @return Interpolated value: a + t*(b - a).
      */
     constexpr float4 lerp(const float4 a, const float4 b, const float t) noexcept { return a + (b - a) * t; }
+
+    /**
+     * @brief Linearly interpolates between two values.
+     *
+     * When t = 0, returns a. When t = 1, returns b.
+     * Values outside [0, 1] perform extrapolation.
+     *
+     * @param a Start value.
+     * @param b End value.
+     * @param t Interpolation factor.
+     * @return Interpolated value: a + t*(b - a).
+     */
+    constexpr float8 lerp(const float8 a, const float8 b, const float t) noexcept { return a + (b - a) * t; }
+
+    /**
+     * @brief Linearly interpolates between two values.
+     *
+     * When t = 0, returns a. When t = 1, returns b.
+     * Values outside [0, 1] perform extrapolation.
+     *
+     * @param a Start value.
+     * @param b End value.
+     * @param t Interpolation factor.
+     * @return Interpolated value: a + t*(b - a).
+     */
+    constexpr float16 lerp(const float16 a, const float16 b, const float t) noexcept { return a + (b - a) * t; }
+
+    // ========================================
+    // Batch normalization
+    // ========================================
+
+    namespace detail {
+        /**
+         * @brief Shared kernel for the span overloads of normalize_fast() / normalize_unsafe().
+         *
+         * Gathers four squared lengths into one float4 so a single rsqrt serves four vectors.
+         */
+        template<bool ZeroCheck, typename V>
+        inline void normalize_span(const std::span<const V> in, const std::span<V> out) noexcept
+        {
+            assert(out.size() >= in.size());
+
+            const size_t count{ in.size() };
+            dispatch([&]() CHLM_KERNEL
+            {
+                size_t i{ 0 };
+                for (; i + 4 <= count; i += 4)
+                {
+                    const V v0{ in[i + 0] };
+                    const V v1{ in[i + 1] };
+                    const V v2{ in[i + 2] };
+                    const V v3{ in[i + 3] };
+                    const float4 len_sq{ length_squared(v0), length_squared(v1), length_squared(v2), length_squared(v3) };
+
+                    float4 inv_len{ rsqrt(len_sq) };
+                    if constexpr (ZeroCheck)
+                        inv_len = select(len_sq > epsilon * epsilon, inv_len, float4_zero);
+
+                    out[i + 0] = v0 * inv_len.x;
+                    out[i + 1] = v1 * inv_len.y;
+                    out[i + 2] = v2 * inv_len.z;
+                    out[i + 3] = v3 * inv_len.w;
+                }
+
+                for (; i < count; ++i)
+                    out[i] = ZeroCheck ? normalize_fast(in[i]) : normalize_unsafe(in[i]);
+            });
+        }
+    } // namespace detail
+
+    /**
+     * @brief Normalizes an array of vectors with normalize_fast() semantics.
+     *
+     * @param in  Source vectors.
+     * @param out Destination (at least in.size() elements, may alias @p in).
+     */
+    inline void normalize_fast(const std::span<const float3> in, const std::span<float3> out) noexcept
+    {
+        detail::normalize_span<true>(in, out);
+    }
+
+    /**
+     * @brief Normalizes an array of vectors with normalize_fast() semantics.
+     *
+     * @param in  Source vectors.
+     * @param out Destination (at least in.size() elements, may alias @p in).
+     */
+    inline void normalize_fast(const std::span<const float4> in, const std::span<float4> out) noexcept
+    {
+        detail::normalize_span<true>(in, out);
+    }
+
+    /**
+     * @brief Normalizes an array of non-zero vectors with normalize_unsafe() semantics.
+     *
+     * @param in  Source vectors (all non-zero).
+     * @param out Destination (at least in.size() elements, may alias @p in).
+     */
+    inline void normalize_unsafe(const std::span<const float3> in, const std::span<float3> out) noexcept
+    {
+        detail::normalize_span<false>(in, out);
+    }
+
+    /**
+     * @brief Normalizes an array of non-zero vectors with normalize_unsafe() semantics.
+     *
+     * @param in  Source vectors (all non-zero).
+     * @param out Destination (at least in.size() elements, may alias @p in).
+     */
+    inline void normalize_unsafe(const std::span<const float4> in, const std::span<float4> out) noexcept
+    {
+        detail::normalize_span<false>(in, out);
+    }
+
+    // ========================================
+    // Component-wise min / max / clamp
+    // ========================================
+    // Non-template overloads so vectors never reach the scalar templates in Core.h.
+
+    /**
+     * @brief Returns the component-wise minimum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding min(a[i], b[i]) in each lane.
+     */
+    constexpr float2 min(const float2 a, const float2 b) noexcept { return __builtin_elementwise_min(a, b); }
+
+    /**
+     * @brief Returns the component-wise maximum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding max(a[i], b[i]) in each lane.
+     */
+    constexpr float2 max(const float2 a, const float2 b) noexcept { return __builtin_elementwise_max(a, b); }
+
+    /**
+     * @brief Clamps each component of a vector to the inclusive range [lo, hi].
+     *
+     * @param v  Vector to clamp.
+     * @param lo Per-component lower bound.
+     * @param hi Per-component upper bound.
+     * @return Clamped vector.
+     */
+    constexpr float2 clamp(const float2 v, const float2 lo, const float2 hi) noexcept { return min(max(v, lo), hi); }
+
+    /**
+     * @brief Returns the component-wise minimum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding min(a[i], b[i]) in each lane.
+     */
+    constexpr float3 min(const float3 a, const float3 b) noexcept { return __builtin_elementwise_min(a, b); }
+
+    /**
+     * @brief Returns the component-wise maximum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding max(a[i], b[i]) in each lane.
+     */
+    constexpr float3 max(const float3 a, const float3 b) noexcept { return __builtin_elementwise_max(a, b); }
+
+    /**
+     * @brief Clamps each component of a vector to the inclusive range [lo, hi].
+     *
+     * @param v  Vector to clamp.
+     * @param lo Per-component lower bound.
+     * @param hi Per-component upper bound.
+     * @return Clamped vector.
+     */
+    constexpr float3 clamp(const float3 v, const float3 lo, const float3 hi) noexcept { return min(max(v, lo), hi); }
+
+    /**
+     * @brief Returns the component-wise minimum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding min(a[i], b[i]) in each lane.
+     */
+    constexpr float4 min(const float4 a, const float4 b) noexcept { return __builtin_elementwise_min(a, b); }
+
+    /**
+     * @brief Returns the component-wise maximum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding max(a[i], b[i]) in each lane.
+     */
+    constexpr float4 max(const float4 a, const float4 b) noexcept { return __builtin_elementwise_max(a, b); }
+
+    /**
+     * @brief Clamps each component of a vector to the inclusive range [lo, hi].
+     *
+     * @param v  Vector to clamp.
+     * @param lo Per-component lower bound.
+     * @param hi Per-component upper bound.
+     * @return Clamped vector.
+     */
+    constexpr float4 clamp(const float4 v, const float4 lo, const float4 hi) noexcept { return min(max(v, lo), hi); }
+
+    /**
+     * @brief Returns the component-wise minimum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding min(a[i], b[i]) in each lane.
+     */
+    constexpr float8 min(const float8 a, const float8 b) noexcept { return __builtin_elementwise_min(a, b); }
+
+    /**
+     * @brief Returns the component-wise maximum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding max(a[i], b[i]) in each lane.
+     */
+    constexpr float8 max(const float8 a, const float8 b) noexcept { return __builtin_elementwise_max(a, b); }
+
+    /**
+     * @brief Clamps each component of a vector to the inclusive range [lo, hi].
+     *
+     * @param v  Vector to clamp.
+     * @param lo Per-component lower bound.
+     * @param hi Per-component upper bound.
+     * @return Clamped vector.
+     */
+    constexpr float8 clamp(const float8 v, const float8 lo, const float8 hi) noexcept { return min(max(v, lo), hi); }
+
+    /**
+     * @brief Returns the component-wise minimum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding min(a[i], b[i]) in each lane.
+     */
+    constexpr float16 min(const float16 a, const float16 b) noexcept { return __builtin_elementwise_min(a, b); }
+
+    /**
+     * @brief Returns the component-wise maximum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding max(a[i], b[i]) in each lane.
+     */
+    constexpr float16 max(const float16 a, const float16 b) noexcept { return __builtin_elementwise_max(a, b); }
+
+    /**
+     * @brief Clamps each component of a vector to the inclusive range [lo, hi].
+     *
+     * @param v  Vector to clamp.
+     * @param lo Per-component lower bound.
+     * @param hi Per-component upper bound.
+     * @return Clamped vector.
+     */
+    constexpr float16 clamp(const float16 v, const float16 lo, const float16 hi) noexcept { return min(max(v, lo), hi); }
+
+    /**
+     * @brief Returns the component-wise minimum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding min(a[i], b[i]) in each lane.
+     */
+    constexpr int4 min(const int4 a, const int4 b) noexcept { return __builtin_elementwise_min(a, b); }
+
+    /**
+     * @brief Returns the component-wise maximum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding max(a[i], b[i]) in each lane.
+     */
+    constexpr int4 max(const int4 a, const int4 b) noexcept { return __builtin_elementwise_max(a, b); }
+
+    /**
+     * @brief Clamps each component of a vector to the inclusive range [lo, hi].
+     *
+     * @param v  Vector to clamp.
+     * @param lo Per-component lower bound.
+     * @param hi Per-component upper bound.
+     * @return Clamped vector.
+     */
+    constexpr int4 clamp(const int4 v, const int4 lo, const int4 hi) noexcept { return min(max(v, lo), hi); }
+
+    /**
+     * @brief Returns the component-wise minimum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding min(a[i], b[i]) in each lane.
+     */
+    constexpr int8 min(const int8 a, const int8 b) noexcept { return __builtin_elementwise_min(a, b); }
+
+    /**
+     * @brief Returns the component-wise maximum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding max(a[i], b[i]) in each lane.
+     */
+    constexpr int8 max(const int8 a, const int8 b) noexcept { return __builtin_elementwise_max(a, b); }
+
+    /**
+     * @brief Clamps each component of a vector to the inclusive range [lo, hi].
+     *
+     * @param v  Vector to clamp.
+     * @param lo Per-component lower bound.
+     * @param hi Per-component upper bound.
+     * @return Clamped vector.
+     */
+    constexpr int8 clamp(const int8 v, const int8 lo, const int8 hi) noexcept { return min(max(v, lo), hi); }
+
+    /**
+     * @brief Returns the component-wise minimum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding min(a[i], b[i]) in each lane.
+     */
+    constexpr int16 min(const int16 a, const int16 b) noexcept { return __builtin_elementwise_min(a, b); }
+
+    /**
+     * @brief Returns the component-wise maximum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding max(a[i], b[i]) in each lane.
+     */
+    constexpr int16 max(const int16 a, const int16 b) noexcept { return __builtin_elementwise_max(a, b); }
+
+    /**
+     * @brief Clamps each component of a vector to the inclusive range [lo, hi].
+     *
+     * @param v  Vector to clamp.
+     * @param lo Per-component lower bound.
+     * @param hi Per-component upper bound.
+     * @return Clamped vector.
+     */
+    constexpr int16 clamp(const int16 v, const int16 lo, const int16 hi) noexcept { return min(max(v, lo), hi); }
+
+    /**
+     * @brief Returns the component-wise minimum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding min(a[i], b[i]) in each lane.
+     */
+    constexpr uint4 min(const uint4 a, const uint4 b) noexcept { return __builtin_elementwise_min(a, b); }
+
+    /**
+     * @brief Returns the component-wise maximum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding max(a[i], b[i]) in each lane.
+     */
+    constexpr uint4 max(const uint4 a, const uint4 b) noexcept { return __builtin_elementwise_max(a, b); }
+
+    /**
+     * @brief Clamps each component of a vector to the inclusive range [lo, hi].
+     *
+     * @param v  Vector to clamp.
+     * @param lo Per-component lower bound.
+     * @param hi Per-component upper bound.
+     * @return Clamped vector.
+     */
+    constexpr uint4 clamp(const uint4 v, const uint4 lo, const uint4 hi) noexcept { return min(max(v, lo), hi); }
+
+    /**
+     * @brief Returns the component-wise minimum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding min(a[i], b[i]) in each lane.
+     */
+    constexpr uint8 min(const uint8 a, const uint8 b) noexcept { return __builtin_elementwise_min(a, b); }
+
+    /**
+     * @brief Returns the component-wise maximum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding max(a[i], b[i]) in each lane.
+     */
+    constexpr uint8 max(const uint8 a, const uint8 b) noexcept { return __builtin_elementwise_max(a, b); }
+
+    /**
+     * @brief Clamps each component of a vector to the inclusive range [lo, hi].
+     *
+     * @param v  Vector to clamp.
+     * @param lo Per-component lower bound.
+     * @param hi Per-component upper bound.
+     * @return Clamped vector.
+     */
+    constexpr uint8 clamp(const uint8 v, const uint8 lo, const uint8 hi) noexcept { return min(max(v, lo), hi); }
+
+    /**
+     * @brief Returns the component-wise minimum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding min(a[i], b[i]) in each lane.
+     */
+    constexpr uint16 min(const uint16 a, const uint16 b) noexcept { return __builtin_elementwise_min(a, b); }
+
+    /**
+     * @brief Returns the component-wise maximum of two vectors.
+     *
+     * @param a First vector.
+     * @param b Second vector.
+     * @return Vector holding max(a[i], b[i]) in each lane.
+     */
+    constexpr uint16 max(const uint16 a, const uint16 b) noexcept { return __builtin_elementwise_max(a, b); }
+
+    /**
+     * @brief Clamps each component of a vector to the inclusive range [lo, hi].
+     *
+     * @param v  Vector to clamp.
+     * @param lo Per-component lower bound.
+     * @param hi Per-component upper bound.
+     * @return Clamped vector.
+     */
+    constexpr uint16 clamp(const uint16 v, const uint16 lo, const uint16 hi) noexcept { return min(max(v, lo), hi); }
+
+    // ========================================
+    // Component-wise abs
+    // ========================================
+
+    /**
+     * @brief Returns the component-wise absolute value of a vector.
+     *
+     * @param v Input vector.
+     * @return Vector holding |v[i]| in each lane.
+     */
+    constexpr float2 abs(const float2 v) noexcept { return __builtin_elementwise_abs(v); }
+
+    /**
+     * @brief Returns the component-wise absolute value of a vector.
+     *
+     * @param v Input vector.
+     * @return Vector holding |v[i]| in each lane.
+     */
+    constexpr float3 abs(const float3 v) noexcept { return __builtin_elementwise_abs(v); }
+
+    /**
+     * @brief Returns the component-wise absolute value of a vector.
+     *
+     * @param v Input vector.
+     * @return Vector holding |v[i]| in each lane.
+     */
+    constexpr float4 abs(const float4 v) noexcept { return __builtin_elementwise_abs(v); }
+
+    /**
+     * @brief Returns the component-wise absolute value of a vector.
+     *
+     * @param v Input vector.
+     * @return Vector holding |v[i]| in each lane.
+     */
+    constexpr float8 abs(const float8 v) noexcept { return __builtin_elementwise_abs(v); }
+
+    /**
+     * @brief Returns the component-wise absolute value of a vector.
+     *
+     * @param v Input vector.
+     * @return Vector holding |v[i]| in each lane.
+     */
+    constexpr float16 abs(const float16 v) noexcept { return __builtin_elementwise_abs(v); }
 } // namespace chlm
@@ -5,7 +5,10 @@
 
 #include "../include/chlm/CarrotHLM.h"
 
+#include <algorithm>
+#include <cstring>
 #include <print>
+#include <vector>
 
 constexpr float GENERAL_EPS = 1e-4f;  // or 1e-5f
 
@@ -77,9 +80,1099 @@ void test_inverse()
     float4x4 invM = inverse(M);
     float4x4 check = M * invM;
     if (almost_equal(check, float4x4::identity()))
-        std::println("Random matrix test: PASSED\n");
+        std::println("Random matrix test: PASSED");
     else
-        std::println("Random matrix test: FAILED\n");
+        std::println("Random matrix test: FAILED");
+
+    // 5. Cofactor inverse agrees with the pivoting path, determinant matches
+    if (almost_equal(invM, inverse_precise(M)) && almost_equal(determinant(M), -82.0f, GENERAL_EPS))
+        std::println("Cofactor vs Gauss-Jordan test: PASSED");
+    else
+        std::println("Cofactor vs Gauss-Jordan test: FAILED");
+
+    // 5b. Tiny uniform scale: det is 1e-12, still invertible; a zero column is not
+    const float4x4 tiny{
+        float4x4::translate({ 3.f, -1.f, 2.f }) *
+        float4x4::rotate_axis_angle(normalize(float3{ 2.f, 1.f, -1.f }), .4f) *
+        float4x4::scale({ 1e-4f, 1e-4f, 1e-4f })
+    };
+    float4x4 flat{ tiny };
+    flat[1] = float4_zero;
+    if (almost_equal(tiny * inverse(tiny), float4x4::identity()) &&
+        almost_equal(inverse(flat), float4x4::identity()))
+        std::println("Small-scale inverse test: PASSED");
+    else
+        std::println("Small-scale inverse test: FAILED");
+
+    // 6. Affine fast path with non-uniform scale, normal matrix = inverse-transpose
+    const float4x4 S{
+        float4x4::translate({ 2.f, -1.f, 5.f }) *
+        float4x4::rotate_axis_angle(normalize(float3{ 1.f, 2.f, 3.f }), 0.7f) *
+        float4x4::scale({ 3.f, .5f, 1.5f })
+    };
+    const float3x3 N{ normal_matrix(S) };
+    const float4x4 inv_S{ inverse(S) };
+    const float3x3 expected_N{ transpose(float3x3{ inv_S[0].xyz, inv_S[1].xyz, inv_S[2].xyz }) };
+    bool normal_ok{ true };
+    for (int i = 0; i < 3; ++i)
+        normal_ok &= almost_equal(float4{ N[i].x, N[i].y, N[i].z, 0.f },
+                                  float4{ expected_N[i].x, expected_N[i].y, expected_N[i].z, 0.f });
+    if (almost_equal(affine_inverse(S), inv_S) && normal_ok)
+        std::println("Scaled affine / normal matrix test: PASSED\n");
+    else
+        std::println("Scaled affine / normal matrix test: FAILED");
+
+    // 7. Same fast paths on the 1e-4 scaled transform: A⁻¹A, Nᵀ A and inv(A) A are identity
+    const float3x3 tiny_upper{ tiny[0].xyz, tiny[1].xyz, tiny[2].xyz };
+    const float3x3 products[]{
+        inverse(tiny_upper) * tiny_upper,
+        transpose(normal_matrix(tiny)) * tiny_upper
+    };
+    bool small_ok{ almost_equal(tiny * affine_inverse(tiny), float4x4::identity()) };
+    for (const float3x3& p : products)
+        for (int i = 0; i < 3; ++i)
+        {
+            float4 expected{ float4_zero };
+            expected[i] = 1.f;
+            small_ok &= almost_equal(float4{ p[i].x, p[i].y, p[i].z, 0.f }, expected);
+        }
+    if (small_ok)
+        std::println("Small-scale affine / normal matrix test: PASSED\n");
+    else
+        std::println("Small-scale affine / normal matrix test: FAILED\n");
+}
+
+void test_float3x4()
+{
+    using namespace chlm;
+
+    std::println("Testing float3x4...");
+
+    float4x4 shear;
+    shear[1] = float4{ .5f, 1.f, 0.f, 0.f };
+    shear[2] = float4{ .3f, -.2f, 1.f, 0.f };
+
+    // Centimetre-scale, sheared and translated: det is about 1e-6
+    const float4x4 a{
+        float4x4::translate({ 4.f, -2.f, 7.f }) *
+        float4x4::rotate_axis_angle(normalize(float3{ 1.f, 2.f, 3.f }), .9f) *
+        shear *
+        float4x4::scale({ .01f, .01f, .01f })
+    };
+    const float4x4 b{
+        float4x4::translate({ -1.f, .5f, 2.f }) *
+        float4x4::rotate_y(-.4f) *
+        float4x4::scale({ 2.f, .5f, 1.5f })
+    };
+
+    const float3x4 a34{ to_float3x4(a) };
+    const float3x4 b34{ to_float3x4(b) };
+
+    const bool round_trip{ almost_equal(to_float4x4(a34), a) && almost_equal(to_float4x4(b34), b) };
+    const bool product{ almost_equal(to_float4x4(mul(b34, a34)), b * a) &&
+                        almost_equal(to_float4x4(a34 * b34), a * b) };
+
+    const float3 p{ 3.f, -1.f, .5f };
+    const float4 expected_point{ b * float4{ p.x, p.y, p.z, 1.f } };
+    const float4 expected_vector{ b * float4{ p.x, p.y, p.z, 0.f } };
+    const float3 point{ transform_point(b34, p) };
+    const float3 vector{ transform_vector(b34, p) };
+    const bool transforms{
+        almost_equal(float4{ point.x, point.y, point.z, 1.f }, expected_point) &&
+        almost_equal(float4{ vector.x, vector.y, vector.z, 0.f }, expected_vector)
+    };
+
+    // Inverse of the small scaled transform, and a genuinely singular one
+    const float3x4 inv_a{ inverse(a34) };
+    const float3 q{ transform_point(a34, p) };
+    const float3 back{ transform_point(inv_a, q) };
+    const float3x4 flat{ to_float3x4(float4x4::scale({ 1.f, 1.f, 0.f })) };
+    const bool inverses{
+        almost_equal(to_float4x4(mul(a34, inv_a)), float4x4::identity()) &&
+        almost_equal(float4{ back.x, back.y, back.z, 0.f }, float4{ p.x, p.y, p.z, 0.f }, 1e-3f) &&
+        almost_equal(to_float4x4(mul(b34, inverse(b34))), float4x4::identity()) &&
+        almost_equal(to_float4x4(inverse(flat)), float4x4::identity())
+    };
+
+    if (round_trip && product && transforms && inverses)
+        std::println("Conversion / mul / transform / scaled inverse test: PASSED\n");
+    else
+        std::println("Conversion / mul / transform / scaled inverse test: FAILED\n");
+}
+
+void test_batch_transform()
+{
+    using namespace chlm;
+
+    std::println("Testing batch transforms...");
+
+    const float4x4 model{
+        float4x4::translate({ 1.f, -2.f, 3.f }) *
+        float4x4::rotate_axis_angle(normalize(float3{ 1.f, 2.f, 3.f }), 0.7f) *
+        float4x4::scale({ 2.f, .5f, 1.5f })
+    };
+
+    // 7 points exercises both the 4-wide body and the scalar tail
+    float3 points[7];
+    float xs[7], ys[7], zs[7];
+    for (int i = 0; i < 7; ++i)
+    {
+        points[i] = float3{ static_cast<float>(i), 1.f - i * .5f, i * i * .25f };
+        xs[i] = points[i].x;
+        ys[i] = points[i].y;
+        zs[i] = points[i].z;
+    }
+
+    float3 aos_out[7];
+    float out_xs[7], out_ys[7], out_zs[7];
+    transform_points(model, points, aos_out);
+    transform_points(model, xs, ys, zs, out_xs, out_ys, out_zs);
+
+    bool passed{ true };
+    for (int i = 0; i < 7; ++i)
+    {
+        const float4 expected{ model * float4{ points[i].x, points[i].y, points[i].z, 1.f } };
+        passed &= almost_equal(float4{ aos_out[i].x, aos_out[i].y, aos_out[i].z, 1.f }, expected);
+        passed &= almost_equal(float4{ out_xs[i], out_ys[i], out_zs[i], 1.f }, expected);
+    }
+
+    if (passed)
+        std::println("Batch point transform test: PASSED");
+    else
+        std::println("Batch point transform test: FAILED");
+
+    // Fixed left (view-projection * model) and fixed right batches
+    const float4x4 view_proj{ float4x4::perspective_lh(1.f, 16.f / 9.f, .1f, 100.f) };
+    float4x4 models[3]{ model, float4x4::translate({ 4.f, 5.f, 6.f }), float4x4::rotate_y(1.2f) };
+    float4x4 left_out[3], right_out[3];
+    mul(view_proj, models, left_out);
+    mul(models, view_proj, right_out);
+
+    bool mul_passed{ true };
+    for (int i = 0; i < 3; ++i)
+    {
+        mul_passed &= almost_equal(left_out[i], view_proj * models[i]);
+        mul_passed &= almost_equal(right_out[i], models[i] * view_proj);
+    }
+
+    if (mul_passed)
+        std::println("Batch matrix multiply test: PASSED\n");
+    else
+        std::println("Batch matrix multiply test: FAILED\n");
+}
+
+void test_soa()
+{
+    using namespace chlm;
+
+    std::println("Testing SoA containers...");
+
+    // 13 elements: not a multiple of the 4-wide transpose nor of the 16-lane padding
+    std::vector<float3> points;
+    std::vector<float4> spheres;
+    for (int i = 0; i < 13; ++i)
+    {
+        points.push_back(float3{ static_cast<float>(i), -.5f * i, i * i * .25f });
+        spheres.push_back(float4{ 1.f - i, static_cast<float>(i) * 3.f, .1f * i, 2.f + i });
+    }
+
+    float3_soa soa3;
+    float4_soa soa4;
+    to_soa(points, soa3);
+    to_soa(spheres, soa4);
+
+    std::vector<float3> points_back(points.size());
+    std::vector<float4> spheres_back(spheres.size());
+    to_aos(soa3, points_back);
+    to_aos(soa4, spheres_back);
+
+    bool round_trip{ soa3.size() == 13 && soa3.padded_size() == 16 && soa4.size() == 13 };
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        round_trip &= points_back[i].x == points[i].x && points_back[i].y == points[i].y &&
+                      points_back[i].z == points[i].z;
+        round_trip &= almost_equal(spheres_back[i], spheres[i], 0.f);
+        round_trip &= soa3.x()[i] == points[i].x && soa4.w()[i] == spheres[i].w;
+    }
+
+    // Writes through the proxies land in the component arrays
+    soa3[2] = static_cast<float3>(soa3[2]) * 2.f;
+    soa3[4].y = 7.f;
+    soa4[12] = float4{ 9.f, 8.f, 7.f, 6.f };
+    soa3[5] = soa3[6];
+    const float3_soa& const_soa3{ soa3 };
+    const float3 read{ const_soa3[2] };
+    bool proxies{ read.x == 4.f && read.y == -2.f && read.z == 2.f && soa3.y()[4] == 7.f &&
+                  soa4.x()[12] == 9.f && soa4.w()[12] == 6.f && soa3.z()[5] == points[6].z };
+
+    // Iterators: random access, including n + it
+    proxies &= std::ranges::distance(soa3.begin(), soa3.end()) == 13;
+    proxies &= static_cast<float3>(*(3 + soa3.begin())).x == 3.f && static_cast<float3>(soa3.begin()[3]).x == 3.f;
+    float sum_x{ 0.f };
+    for (const float3 p : const_soa3)
+        sum_x += p.x;
+    proxies &= sum_x == 81.f; // 0 + 1 + ... + 12, with x[2] doubled and x[5] = x[6]
+
+    // Shrinking and growing again zero-fills the reused padding lanes
+    soa3.resize(5);
+    soa3.resize(13);
+    soa3.push_back(float3{ 1.f, 2.f, 3.f });
+    bool padding{ soa3.size() == 14 && soa3.padded_size() == 16 && soa3.z()[13] == 3.f };
+    for (size_t i = 5; i < 13; ++i)
+        padding &= soa3.x()[i] == 0.f && soa3.y()[i] == 0.f && soa3.z()[i] == 0.f;
+
+    if (round_trip && proxies && padding)
+        std::println("AoS/SoA round trip / proxy / padding test: PASSED\n");
+    else
+        std::println("AoS/SoA round trip / proxy / padding test: FAILED\n");
+}
+
+void test_packed()
+{
+    using namespace chlm;
+
+    std::println("Testing packed storage...");
+
+    static_assert(sizeof(packed_float3) == 12);
+    static_assert(sizeof(packed_float3x3) == 36);
+
+    // 13 elements: three 4-wide groups plus a scalar tail (39 columns for the matrices)
+    constexpr size_t count{ 13 };
+    std::vector<float3> vectors;
+    std::vector<float4> points;
+    std::vector<float3x3> matrices;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float f{ static_cast<float>(i) };
+        vectors.push_back(float3{ f, -f * .5f, f * f });
+        points.push_back(float4{ f + .25f, 2.f * f, -f, 42.f });
+        matrices.push_back(float3x3{ float3{ f, 1.f, 2.f }, float3{ 3.f, f * .1f, 4.f }, float3{ 5.f, 6.f, -f } });
+    }
+
+    std::vector<packed_float3> packed(count), packed_points(count);
+    std::vector<packed_float3x3> packed_matrices(count);
+    pack(vectors, packed);
+    pack(points, packed_points);
+    pack(matrices, packed_matrices);
+
+    std::vector<float3> vectors_back(count);
+    std::vector<float4> points_back(count);
+    std::vector<float3x3> matrices_back(count);
+    unpack(packed, vectors_back);
+    unpack(packed_points, points_back, 1.f);
+    unpack(packed_matrices, matrices_back);
+
+    const auto same = [](const float3 a, const float3 b) { return a.x == b.x && a.y == b.y && a.z == b.z; };
+    bool passed{ true };
+    for (size_t i = 0; i < count; ++i)
+    {
+        passed &= same(vectors_back[i], vectors[i]) && same(to_float3(packed[i]), vectors[i]);
+        passed &= same(points_back[i].xyz, points[i].xyz) && points_back[i].w == 1.f;
+        passed &= packed_points[i].x == points[i].x && packed_points[i].z == points[i].z;
+        for (int c = 0; c < 3; ++c)
+            passed &= same(matrices_back[i][c], matrices[i][c]);
+    }
+
+    if (passed)
+        std::println("Bulk pack/unpack round trip test: PASSED\n");
+    else
+        std::println("Bulk pack/unpack round trip test: FAILED\n");
+}
+
+chlm::float4x4 naive_world(const chlm::transform_hierarchy& h, const int32_t node)
+{
+    const int32_t parent{ h.parents[node] };
+    return parent < 0 ? h.locals[node] : chlm::mul(naive_world(h, parent), h.locals[node]);
+}
+
+void test_transform_hierarchy()
+{
+    using namespace chlm;
+
+    std::println("Testing transform hierarchy...");
+
+    // 2 roots, 4 inner nodes, then two levels of 5000 nodes: large enough that the
+    // parallel path splits each of the wide levels into several chunks
+    transform_hierarchy h;
+    std::vector<uint32_t> level_first{ 0 };
+    const uint32_t level_sizes[]{ 2, 4, 5000, 5000 };
+    for (size_t level = 0; level < 4; ++level)
+    {
+        const uint32_t parent_first{ level ? level_first[level - 1] : 0 };
+        const uint32_t parent_count{ level ? level_sizes[level - 1] : 0 };
+        for (uint32_t i = 0; i < level_sizes[level]; ++i)
+        {
+            const float f{ static_cast<float>(i % 17) };
+            const int32_t parent{ level ? static_cast<int32_t>(parent_first + i % parent_count) : -1 };
+            add_node(h, parent, float4x4::translate({ .1f * f, -.05f * f, .2f }) * float4x4::rotate_z(.01f * f));
+        }
+        level_first.push_back(static_cast<uint32_t>(h.parents.size()));
+    }
+
+    const auto matches_naive = [&]()
+    {
+        bool ok{ true };
+        for (uint32_t i = 0; i < h.parents.size(); ++i)
+            ok &= almost_equal(h.worlds[i], naive_world(h, static_cast<int32_t>(i)));
+        return ok;
+    };
+
+    update_world_transforms(h);
+    const bool serial_ok{ matches_naive() };
+
+    // Move one inner node: only its subtree may change
+    const uint32_t moved{ level_first[1] + 3 };
+    const auto in_subtree = [&](int32_t node)
+    {
+        for (; node >= 0; node = h.parents[node])
+            if (node == static_cast<int32_t>(moved)) return true;
+        return false;
+    };
+
+    const std::vector<float4x4> before{ h.worlds };
+    set_local(h, moved, float4x4::translate({ 0.f, 3.f, 0.f }) * float4x4::rotate_x(.5f));
+    update_world_transforms(h, true);
+
+    bool subtree_ok{ matches_naive() };
+    uint32_t changed{ 0 };
+    for (uint32_t i = 0; i < h.parents.size(); ++i)
+    {
+        const bool same{ std::memcmp(&before[i], &h.worlds[i], sizeof(float4x4)) == 0 };
+        if (in_subtree(static_cast<int32_t>(i)))
+            changed += same ? 0 : 1;
+        else
+            subtree_ok &= same;
+    }
+    subtree_ok &= changed > 1;
+
+    // Full parallel rebuild from scratch matches the serial result
+    transform_hierarchy parallel_h{ h };
+    std::fill(parallel_h.worlds.begin(), parallel_h.worlds.end(), float4x4{ });
+    build_levels(parallel_h);
+    update_world_transforms(parallel_h, true);
+    bool parallel_ok{ true };
+    for (uint32_t i = 0; i < h.parents.size(); ++i)
+        parallel_ok &= std::memcmp(&parallel_h.worlds[i], &h.worlds[i], sizeof(float4x4)) == 0;
+
+    if (serial_ok && subtree_ok && parallel_ok)
+        std::println("World propagation / dirty subtree / parallel test: PASSED\n");
+    else
+        std::println("World propagation / dirty subtree / parallel test: FAILED\n");
+}
+
+void test_frustum_culling()
+{
+    using namespace chlm;
+
+    std::println("Testing frustum culling...");
+
+    // View-space frustum: +Z forward, near 0.1, far 100
+    const frustum f{ extract_frustum(float4x4::perspective_lh(1.f, 1.f, .1f, 100.f)) };
+
+    // 11 objects covers one 8-wide block and a scalar tail; every third one is in view
+    float4_soa spheres(11);
+    float3_soa mins(11), maxs(11);
+    uint32_t expected{ 0 };
+    for (int i = 0; i < 11; ++i)
+    {
+        const float3 center{ i % 3 == 0 ? 0.f : 50.f, 0.f, 10.f + i };
+        spheres[i] = float4{ center.x, center.y, center.z, 1.f };
+        mins[i] = center - 1.f;
+        maxs[i] = center + 1.f;
+        expected |= (i % 3 == 0 ? 1u : 0u) << i;
+    }
+
+    uint32_t sphere_bits{ 0 }, box_bits{ 0 };
+    cull_spheres(f, spheres, std::span{ &sphere_bits, 1 });
+    cull_aabbs(f, mins, maxs, std::span{ &box_bits, 1 });
+
+    const bool behind_culled{ !intersects(f, float3{ 0.f, 0.f, -10.f }, 1.f) &&
+                              !intersects(f, float3{ 0.f, 0.f, 200.f }, 1.f) };
+
+    // ortho_rh maps depth to [-1, 1]: view space looks down -Z, near 1, far 50
+    const frustum ortho{ extract_frustum(float4x4::ortho_rh(10.f, 10.f, 1.f, 50.f), clip_depth::minus_one_to_one) };
+    const bool ortho_ok{ intersects(ortho, float3{ 0.f, 0.f, -2.f }, .5f) &&
+                         intersects(ortho, float3{ 0.f, 0.f, -48.f }, .5f) &&
+                         !intersects(ortho, float3{ 0.f, 0.f, 1.f }, .5f) &&
+                         !intersects(ortho, float3{ 0.f, 0.f, -52.f }, .5f) &&
+                         !intersects(ortho, float3{ 7.f, 0.f, -10.f }, .5f) &&
+                         almost_equal(ortho.planes[4].w, -1.f, GENERAL_EPS) };
+
+    if (sphere_bits == expected && box_bits == expected && behind_culled && ortho_ok)
+        std::println("Sphere / AABB culling test: PASSED\n");
+    else
+        std::println("Sphere / AABB culling test: FAILED\n");
+}
+
+void test_aabb()
+{
+    using namespace chlm;
+
+    std::println("Testing AABB...");
+
+    aabb3 box;
+    const bool starts_empty{ empty(box) };
+    box = merge(box, float3{ -1.f, 0.f, 2.f });
+    box = merge(box, float3{ 1.f, 2.f, 4.f });
+
+    // Rotating 90° about Y and translating must match transforming all corners
+    const float4x4 m{ float4x4::translate({ 5.f, 0.f, 0.f }) * float4x4::rotate_y(half_pi) };
+    const aabb3 moved{ transform(m, box) };
+
+    aabb3 expected;
+    for (int i = 0; i < 8; ++i)
+    {
+        const float4 corner{ i & 1 ? 1.f : -1.f, i & 2 ? 2.f : 0.f, i & 4 ? 4.f : 2.f, 1.f };
+        expected = merge(expected, (m * corner).xyz);
+    }
+
+    if (starts_empty && almost_equal(surface_area(box), 2.f * (4.f + 4.f + 4.f), GENERAL_EPS) &&
+        contains(box, float3{ 1.f, 2.f, 4.f }) && !contains(box, float3{ 0.f, 3.f, 3.f }) &&
+        almost_equal(moved.min, expected.min) && almost_equal(moved.max, expected.max))
+        std::println("Merge / area / transform test: PASSED\n");
+    else
+        std::println("Merge / area / transform test: FAILED\n");
+}
+
+void test_raycast()
+{
+    using namespace chlm;
+
+    std::println("Testing ray packets...");
+
+    const aabb3 box{ make_aabb({ -1.f, -1.f, 4.f }, { 1.f, 1.f, 6.f }) };
+    const float3 v0{ -1.f, -1.f, 3.f }, v1{ 2.f, -1.f, 3.f }, v2{ -1.f, 2.f, 3.f };
+
+    // 5 rays in an 8-wide packet: the 3 unused lanes must never report a hit
+    ray rays[5];
+    for (int i = 0; i < 5; ++i)
+        rays[i] = ray{ float3{ i * .6f - 1.2f, .25f, 0.f }, normalize(float3{ 0.f, 0.f, 1.f }) };
+
+    const ray_packet8 packet{ make_ray_packet<float8>(rays) };
+    float8 box_t, tri_t, tri_u, tri_v;
+    const uint32_t box_hits{ raycast(packet, box, box_t) };
+    const uint32_t tri_hits{ raycast(packet, v0, v1, v2, tri_t, tri_u, tri_v) };
+
+    bool passed{ true };
+    for (int i = 0; i < 5; ++i)
+    {
+        float t, u, v;
+        const bool box_hit{ raycast(rays[i], box, t) };
+        passed &= box_hit == ((box_hits >> i) & 1u) && (!box_hit || almost_equal(t, box_t[i], GENERAL_EPS));
+
+        const bool tri_hit{ raycast(rays[i], v0, v1, v2, t, u, v) };
+        passed &= tri_hit == ((tri_hits >> i) & 1u) && (!tri_hit || almost_equal(t, tri_t[i], GENERAL_EPS));
+    }
+    passed &= (box_hits >> 5) == 0 && (tri_hits >> 5) == 0 && box_hits != 0 && tri_hits != 0;
+
+    // Empty boxes never hit: the default (+inf / -inf) box and a finite inverted one
+    const aabb3 inverted{ intersection(make_aabb({ -1.f, -1.f, 4.f }, { 1.f, 1.f, 5.f }),
+                                       make_aabb({ -1.f, -1.f, 5.5f }, { 1.f, 1.f, 6.f })) };
+    float empty_t;
+    float8 empty_packet_t;
+    passed &= empty(inverted) && !raycast(rays[2], aabb3{ }, empty_t) && !raycast(rays[2], inverted, empty_t);
+    passed &= raycast(packet, aabb3{ }, empty_packet_t) == 0 && raycast(packet, inverted, empty_packet_t) == 0;
+
+    if (passed)
+        std::println("Packet vs scalar slab / triangle test: PASSED\n");
+    else
+        std::println("Packet vs scalar slab / triangle test: FAILED\n");
+}
+
+void test_bvh()
+{
+    using namespace chlm;
+
+    std::println("Testing BVH4...");
+
+    // 10x10x10 grid of small boxes
+    std::vector<aabb3> boxes;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const float3 c{ static_cast<float>(i % 10), static_cast<float>(i / 10 % 10), static_cast<float>(i / 100) };
+        boxes.push_back(make_aabb(c * 2.f - .4f, c * 2.f + .4f));
+    }
+    const bvh4 bvh{ build_bvh4(boxes, 4, true) };
+
+    // Closest hit through the BVH must match brute force
+    const ray r{ float3{ -5.f, 4.1f, 6.2f }, normalize(float3{ 1.f, .05f, .02f }) };
+    uint32_t bvh_hit{ ~0u }, brute_hit{ ~0u };
+    raycast(bvh, r, [&](const uint32_t prim, ray& current)
+    {
+        float t;
+        if (raycast(current, boxes[prim], t))
+        {
+            current.t_max = t;
+            bvh_hit = prim;
+        }
+        return false;
+    });
+    float best{ infinity };
+    for (uint32_t i = 0; i < boxes.size(); ++i)
+    {
+        float t;
+        if (raycast(r, boxes[i], t) && t < best)
+        {
+            best = t;
+            brute_hit = i;
+        }
+    }
+
+    // Frustum query reports every visible box exactly once
+    const frustum f{ extract_frustum(float4x4::perspective_lh(.8f, 1.f, .1f, 12.f) *
+                                     float4x4::look_at_lh({ 9.f, 9.f, -6.f }, { 9.f, 9.f, 9.f }, { 0.f, 1.f, 0.f })) };
+    std::vector<int> reported(boxes.size(), 0);
+    query_frustum(bvh, f, [&](const uint32_t prim) { ++reported[prim]; });
+    bool query_ok{ true };
+    for (uint32_t i = 0; i < boxes.size(); ++i)
+        query_ok &= reported[i] <= 1 && (!intersects(f, boxes[i]) || reported[i] == 1);
+
+    if (bvh_hit == brute_hit && brute_hit != ~0u && query_ok)
+        std::println("Closest hit / frustum query test: PASSED");
+    else
+        std::println("Closest hit / frustum query test: FAILED");
+
+    // 8000 boxes: above the parallel build threshold, so subtrees are built by async tasks
+    std::vector<aabb3> many;
+    for (int i = 0; i < 8000; ++i)
+    {
+        const float3 c{ static_cast<float>(i % 20), static_cast<float>(i / 20 % 20), static_cast<float>(i / 400) };
+        const float3 jitter{ .1f * std::sin(i * 1.7f), .1f * std::cos(i * .3f), .05f * std::sin(i * .11f) };
+        many.push_back(make_aabb(c * 2.f + jitter - .4f, c * 2.f + jitter + .4f));
+    }
+    const bvh4 serial{ build_bvh4(many, 4, false) };
+    const bvh4 parallel{ build_bvh4(many, 4, true) };
+
+    const auto closest_hit = [&](const bvh4& tree, const ray& query)
+    {
+        uint32_t hit{ ~0u };
+        raycast(tree, query, [&](const uint32_t prim, ray& current)
+        {
+            float t;
+            if (raycast(current, many[prim], t))
+            {
+                current.t_max = t;
+                hit = prim;
+            }
+            return false;
+        });
+        return hit;
+    };
+
+    bool parallel_ok{ parallel.primitives.size() == many.size() };
+    for (int i = 0; i < 64; ++i)
+    {
+        const ray query{ float3{ -3.f, 1.f + .6f * (i % 8), .5f + 2.3f * (i / 8) },
+                         normalize(float3{ 1.f, .03f * (i % 5), -.02f * (i % 3) }) };
+        parallel_ok &= closest_hit(serial, query) == closest_hit(parallel, query);
+    }
+
+    const frustum wide{ extract_frustum(float4x4::perspective_lh(1.f, 1.f, .1f, 30.f) *
+                                        float4x4::look_at_lh({ 19.f, 19.f, -8.f }, { 19.f, 19.f, 19.f }, { 0.f, 1.f, 0.f })) };
+    std::vector<int> serial_reported(many.size(), 0), parallel_reported(many.size(), 0);
+    query_frustum(serial, wide, [&](const uint32_t prim) { ++serial_reported[prim]; });
+    query_frustum(parallel, wide, [&](const uint32_t prim) { ++parallel_reported[prim]; });
+    parallel_ok &= serial_reported == parallel_reported;
+
+    // Centroids a denormal apart (flat in x so the centroid keeps the denormal): the bin
+    // scale overflows and the node must still split cleanly
+    std::vector<aabb3> degenerate;
+    for (int i = 0; i < 16; ++i)
+    {
+        const float3 c{ i % 2 ? 1e-40f : 0.f, 0.f, 0.f };
+        degenerate.push_back(make_aabb(c, c + float3{ 0.f, 1.f, 1.f }));
+    }
+    const bvh4 degenerate_bvh{ build_bvh4(degenerate, 2) };
+    const frustum around{ extract_frustum(float4x4::perspective_lh(1.f, 1.f, .1f, 30.f) *
+                                          float4x4::look_at_lh({ 0.f, 0.f, -5.f }, { 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f })) };
+    std::vector<int> degenerate_reported(degenerate.size(), 0);
+    query_frustum(degenerate_bvh, around, [&](const uint32_t prim) { ++degenerate_reported[prim]; });
+    const bool degenerate_ok{ std::ranges::all_of(degenerate_reported, [](const int n) { return n == 1; }) };
+
+    if (parallel_ok && degenerate_ok)
+        std::println("Parallel build / denormal extent test: PASSED\n");
+    else
+        std::println("Parallel build / denormal extent test: FAILED\n");
+}
+
+void test_quaternion()
+{
+    using namespace chlm;
+
+    std::println("Testing quaternions...");
+
+    // Rotations must match the axis-angle matrix of the same rotation
+    const float3 axis{ normalize(float3{ 1.f, -2.f, .5f }) };
+    const quat q{ quat_from_axis_angle(axis, 1.3f) };
+    const float4x4 m{ float4x4::rotate_axis_angle(axis, 1.3f) };
+
+    float3 vectors[5], single[5], axes[5];
+    quat quats[5];
+    for (int i = 0; i < 5; ++i)
+    {
+        vectors[i] = float3{ 1.f + i, -.5f * i, 2.f - i };
+        axes[i] = normalize(float3{ 0.f, 1.f, i * .3f });
+        quats[i] = quat_from_axis_angle(axes[i], .4f * i);
+    }
+    rotate_vectors(q, vectors, single);
+
+    bool passed{ true };
+    for (int i = 0; i < 5; ++i)
+    {
+        const float4 expected{ m * float4{ vectors[i].x, vectors[i].y, vectors[i].z, 0.f } };
+        passed &= almost_equal(float4{ single[i].x, single[i].y, single[i].z, 0.f }, expected);
+    }
+
+    rotate_vectors(quats, vectors, single);
+    for (int i = 0; i < 5; ++i)
+    {
+        const float4 expected{ float4x4::rotate_axis_angle(axes[i], .4f * i) *
+                               float4{ vectors[i].x, vectors[i].y, vectors[i].z, 0.f } };
+        passed &= almost_equal(float4{ single[i].x, single[i].y, single[i].z, 0.f }, expected);
+    }
+
+    if (passed)
+        std::println("Batch rotate_vector test: PASSED");
+    else
+        std::println("Batch rotate_vector test: FAILED");
+
+    // Rotating by a product must match rotating by each factor; the SoA batch must match mul()
+    std::vector<quat> lhs(13), rhs(13);
+    passed = true;
+    for (int i = 0; i < 13; ++i)
+    {
+        lhs[i] = quat_from_axis_angle(normalize(float3{ 1.f, .2f * i, -.5f }), .3f * i);
+        rhs[i] = quat_from_axis_angle(normalize(float3{ -.4f * i, 1.f, .7f }), 1.f - .1f * i);
+
+        const float3 r{ rotate_vector(mul(lhs[i], rhs[i]), vectors[i % 5]) };
+        const float3 expected{ rotate_vector(lhs[i], rotate_vector(rhs[i], vectors[i % 5])) };
+        passed &= almost_equal(float4{ r.x, r.y, r.z, 0.f }, float4{ expected.x, expected.y, expected.z, 0.f });
+    }
+
+    quat_soa a, b, product;
+    to_soa(lhs, a);
+    to_soa(rhs, b);
+    mul(a, b, product);
+    for (int i = 0; i < 13; ++i)
+        passed &= almost_equal(static_cast<float4>(product[i]), mul(lhs[i], rhs[i]));
+
+    if (passed)
+        std::println("Quaternion mul test: PASSED");
+    else
+        std::println("Quaternion mul test: FAILED");
+
+    // Polynomial slerp tracks the exact one; batches match their scalar counterparts
+    quat_soa slerped, nlerped;
+    slerp(a, b, .35f, slerped);
+    nlerp(a, b, .35f, nlerped);
+    passed = true;
+    for (int i = 0; i < 13; ++i)
+    {
+        const quat exact{ slerp(lhs[i], rhs[i], .35f) };
+        passed &= almost_equal(slerp_fast(lhs[i], rhs[i], .35f), exact);
+        passed &= almost_equal(static_cast<float4>(slerped[i]), exact);
+        passed &= almost_equal(static_cast<float4>(nlerped[i]), nlerp(lhs[i], rhs[i], .35f));
+    }
+
+    // Opposite quaternions blend to zero length at t = 0.5: zero like scalar nlerp, not NaN
+    quat_soa opposite;
+    to_soa(std::vector<quat>(lhs.size(), -lhs[4]), opposite);
+    to_soa(std::vector<quat>(lhs.size(), lhs[4]), a);
+    nlerp(a, opposite, .5f, nlerped);
+    for (int i = 0; i < 13; ++i)
+        passed &= almost_equal(static_cast<float4>(nlerped[i]), float4_zero, 0.f) &&
+                  almost_equal(nlerp(lhs[4], -lhs[4], .5f), float4_zero, 0.f);
+
+    if (passed)
+        std::println("Quaternion slerp / nlerp batch test: PASSED\n");
+    else
+        std::println("Quaternion slerp / nlerp batch test: FAILED\n");
+}
+
+void test_skinning()
+{
+    using namespace chlm;
+
+    std::println("Testing dual quaternions / skinning...");
+
+    // Quaternion -> matrix must rotate like rotate_vector; dual quat must match its matrix
+    const float3 axis{ normalize(float3{ 2.f, -1.f, .5f }) };
+    const float4x4 rigid{ float4x4::translate({ 1.f, 2.f, -3.f }) * float4x4::rotate_axis_angle(axis, 2.1f) };
+    const dual_quat dq{ dual_quat_from_float4x4(rigid) };
+
+    const float3 p{ .5f, -1.f, 2.f };
+    const float3 moved{ transform_point(dq, p) };
+    bool passed{ almost_equal(to_float4x4(quat_from_axis_angle(axis, 2.1f)), float4x4::rotate_axis_angle(axis, 2.1f)) &&
+                 almost_equal(to_float4x4(dq), rigid) &&
+                 almost_equal(float4{ moved.x, moved.y, moved.z, 1.f }, rigid * float4{ p.x, p.y, p.z, 1.f }) };
+
+    // Two joints: identity and the rigid transform above, blended 25/75
+    const float3x4 matrices[2]{ float3x4::identity(), to_float3x4(rigid) };
+    const dual_quat duals[2]{ dual_quat{ }, dq };
+    const uint4 joints[3]{ uint4{ 1, 0, 0, 0 }, uint4{ 0, 1, 0, 0 }, uint4{ 0, 1, 1, 1 } };
+    const float4 weights[3]{ float4{ 1.f, 0.f, 0.f, 0.f }, float4{ .25f, .75f, 0.f, 0.f }, float4{ .25f, .25f, .25f, .25f } };
+
+    float3_soa positions(3), linear(3), dual(3);
+    for (int i = 0; i < 3; ++i)
+        positions[i] = p + float3{ static_cast<float>(i), 0.f, 0.f };
+    skin_linear(matrices, joints, weights, positions, linear);
+    skin_dual_quat(duals, joints, weights, positions, dual);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        const float3 v{ positions[i] };
+        const float4 v1{ v.x, v.y, v.z, 1.f };
+        const float w{ weights[i].x };
+        const float4 expected_linear{ (1.f - w) * (rigid * v1) + w * (i == 0 ? rigid * v1 : v1) };
+        const float3 expected_dual{ transform_point(i == 0 ? dq : blend(dual_quat{ }, dq, 1.f - w), v) };
+
+        passed &= almost_equal(float4{ linear[i].x, linear[i].y, linear[i].z, 1.f }, expected_linear);
+        passed &= almost_equal(float4{ dual[i].x, dual[i].y, dual[i].z, 0.f },
+                               float4{ expected_dual.x, expected_dual.y, expected_dual.z, 0.f });
+    }
+
+    if (passed)
+        std::println("Dual quaternion / LBS / DQS test: PASSED\n");
+    else
+        std::println("Dual quaternion / LBS / DQS test: FAILED\n");
+}
+
+void test_trs()
+{
+    using namespace chlm;
+
+    std::println("Testing TRS decompose / compose...");
+
+    const float3 axis{ normalize(float3{ -1.f, 3.f, 2.f }) };
+    const float4x4 m{ float4x4::translate({ 4.f, -2.f, 7.f }) * float4x4::rotate_axis_angle(axis, .9f) *
+                      float4x4::scale({ 2.f, .5f, 3.f }) };
+    const float4x4 mirrored{ m * float4x4::scale({ 1.f, -1.f, 1.f }) };
+
+    const trs parts{ decompose(m) };
+    const quat expected_rotation{ quat_from_axis_angle(axis, .9f) };
+    bool passed{ almost_equal(compose_trs(parts), m) && almost_equal(compose_trs(decompose(mirrored)), mirrored) &&
+                 almost_equal(float4{ parts.scale.x, parts.scale.y, parts.scale.z, 0.f }, float4{ 2.f, .5f, 3.f, 0.f }) &&
+                 std::abs(dot(parts.rotation, expected_rotation)) > 1.f - GENERAL_EPS };
+
+    const float4x4 matrices[2]{ m, mirrored };
+    trs decomposed[2];
+    float4x4 composed[2];
+    decompose(matrices, decomposed);
+    compose_trs(decomposed, composed);
+    passed &= almost_equal(composed[0], m) && almost_equal(composed[1], mirrored);
+
+    if (passed)
+        std::println("TRS round-trip test: PASSED\n");
+    else
+        std::println("TRS round-trip test: FAILED\n");
+}
+
+void test_quat_compression()
+{
+    using namespace chlm;
+
+    std::println("Testing quaternion compression...");
+
+    std::vector<quat> quats(64);
+    for (size_t i = 0; i < quats.size(); ++i)
+    {
+        const float f{ static_cast<float>(i) };
+        quats[i] = quat_from_axis_angle(normalize(float3{ std::sin(f * 1.3f), std::cos(f * .7f), std::sin(f * .3f + 1.f) }),
+                                        f * .37f - 6.f);
+    }
+
+    std::vector<packed_quat32> q32(quats.size());
+    std::vector<packed_quat48> q48(quats.size());
+    std::vector<packed_quat64> q64(quats.size());
+    std::vector<quat> d32(quats.size()), d48(quats.size()), d64(quats.size());
+    pack(quats, q32);
+    pack(quats, q48);
+    pack(quats, q64);
+    unpack(q32, d32);
+    unpack(q48, d48);
+    unpack(q64, d64);
+
+    // Rotation angle between two unit quaternions, precise for small angles
+    const auto angle{ [](const quat& a, const quat& b)
+    {
+        return 2.f * std::asin(std::min(length(mul(conjugate(a), b).xyz), 1.f));
+    } };
+
+    bool passed{ true };
+    for (size_t i = 0; i < quats.size(); ++i)
+    {
+        passed &= angle(quats[i], d32[i]) <= 4.8e-3f && angle(quats[i], d48[i]) <= 1.5e-4f &&
+                  angle(quats[i], d64[i]) <= 5e-6f;
+        passed &= almost_equal(to_quat(pack_quat48(quats[i])), d48[i], 0.f);
+    }
+
+    if (passed)
+        std::println("Smallest-three 32/48/64-bit round-trip test: PASSED\n");
+    else
+        std::println("Smallest-three 32/48/64-bit round-trip test: FAILED\n");
+}
+
+void test_animation()
+{
+    using namespace chlm;
+
+    std::println("Testing animation sampling...");
+
+    // 10 non-uniform translation tracks (one full 8-track block plus two), one uniform rotation
+    // track and one constant scale track
+    animation_clip clip;
+    const float times[3]{ 0.f, 1.f, 3.f };
+    for (int i = 0; i < 10; ++i)
+    {
+        const float3 keys[3]{ float3{ 0.f, 0.f, 0.f }, float3{ 1.f, 2.f, 3.f } * static_cast<float>(i),
+                              float3{ 5.f, 0.f, -1.f } };
+        add_track<float3>(clip.translation, times, keys);
+    }
+
+    const quat rotations[3]{ quat_identity(), quat_from_axis_angle(up(), half_pi), quat_from_axis_angle(up(), pi) };
+    add_uniform_track<quat>(clip.rotation, 0.f, 1.f, rotations);
+    const float3 scale_key{ 2.f, 2.f, 2.f };
+    add_track<float3>(clip.scale, std::span{ times, 1 }, std::span{ &scale_key, 1 });
+    update_duration(clip);
+
+    animation_cursor cursor;
+    float3_soa translations, scales;
+    quat_soa rots;
+    bool passed{ clip.duration == 3.f && clip.translation.tracks[0].inv_interval == 0.f &&
+                 clip.rotation.tracks[0].inv_interval == 1.f };
+
+    // Sequential playback, then a jump backwards that must reset the cursors
+    for (const float t : { .5f, 1.5f, 2.f, 2.9f, .25f })
+    {
+        sample(clip, t, cursor, translations, rots, scales);
+        for (int i = 0; i < 10; ++i)
+        {
+            const float3 a{ t < 1.f ? float3{ } : float3{ 1.f, 2.f, 3.f } * static_cast<float>(i) };
+            const float3 b{ t < 1.f ? float3{ 1.f, 2.f, 3.f } * static_cast<float>(i) : float3{ 5.f, 0.f, -1.f } };
+            const float3 expected{ lerp(a, b, t < 1.f ? t : (t - 1.f) * .5f) };
+            const float3 got{ translations[i] };
+            passed &= almost_equal(float4{ got.x, got.y, got.z, 0.f }, float4{ expected.x, expected.y, expected.z, 0.f });
+        }
+
+        const int k{ t < 1.f ? 0 : 1 };
+        passed &= almost_equal(static_cast<float4>(rots[0]), slerp(rotations[k], rotations[k + 1], t - k));
+        passed &= almost_equal(float4{ scales[0].x, scales[0].y, scales[0].z, 0.f }, float4{ 2.f, 2.f, 2.f, 0.f });
+    }
+
+    if (passed)
+        std::println("Clip sampling test: PASSED\n");
+    else
+        std::println("Clip sampling test: FAILED\n");
+}
+
+void test_vector_trig()
+{
+    using namespace chlm;
+
+    std::println("Testing vectorized trig...");
+
+    float max_precise{ 0.f };
+    float max_fast{ 0.f };
+    float max_acos{ 0.f };
+    for (int i = 0; i < 1000; ++i)
+    {
+        const float base{ -10.f + 20.f * static_cast<float>(i) / 1000.f };
+        const float8 x{ base, base + .001f, base + .002f, base + .003f, base + .004f, base + .005f, base + .006f, base + .007f };
+        const float8 s{ sin(x) };
+        const float8 c{ cos(x) };
+        const float8 fs{ sin<math_policy::fast>(x) };
+        const float8 fc{ cos<math_policy::fast>(x) };
+        const float4 a{ acos(float4{ x.s0, x.s1, x.s2, x.s3 } * .1f) };
+
+        for (int lane = 0; lane < 8; ++lane)
+        {
+            max_precise = std::max({ max_precise, std::abs(s[lane] - std::sin(x[lane])),
+                                     std::abs(c[lane] - std::cos(x[lane])) });
+            max_fast = std::max({ max_fast, std::abs(fs[lane] - std::sin(x[lane])),
+                                  std::abs(fc[lane] - std::cos(x[lane])) });
+        }
+        for (int lane = 0; lane < 4; ++lane)
+            max_acos = std::max(max_acos, std::abs(a[lane] - std::acos(x[lane] * .1f)));
+    }
+
+    if (max_precise <= 1e-6f && max_fast <= 2e-5f && max_acos <= 1e-6f)
+        std::println("sin/cos/acos accuracy test: PASSED");
+    else
+        std::println("sin/cos/acos accuracy test: FAILED (precise {}, fast {}, acos {})", max_precise, max_fast, max_acos);
+
+    // Rotation builders against std::sin / std::cos, including angles past the polynomial range
+    const float angles[]{ 0.f, .3f, -2.5f, 7.f, 100.f, -5000.f, 20000.f, 1e6f, -3e9f, 1e12f };
+    const float3 axis{ normalize(float3{ 1.f, -2.f, .5f }) };
+    bool builders_ok{ true };
+    for (const float a : angles)
+    {
+        const float s{ std::sin(a) }, c{ std::cos(a) };
+        const float hs{ std::sin(a * .5f) }, hc{ std::cos(a * .5f) };
+
+        const quat q{ quat_from_axis_angle(axis, a) };
+        builders_ok &= almost_equal(q, quat{ axis.x * hs, axis.y * hs, axis.z * hs, hc }, 1e-6f);
+
+        const float4x4 rx{ float4x4::rotate_x(a) };
+        const float3x3 rz{ rotate_z(a) };
+        builders_ok &= almost_equal(rx[1].y, c) && almost_equal(rx[1].z, s) && almost_equal(rx[2].y, -s);
+        builders_ok &= almost_equal(rz[0].x, c) && almost_equal(rz[0].y, s) && almost_equal(rz[1].x, -s);
+
+        // Yaw only: rotation of a / 2 around Z
+        const quat e{ quat_from_euler(a, 0.f, 0.f) };
+        builders_ok &= almost_equal(e, quat{ 0.f, 0.f, hs, hc }, 1e-6f);
+    }
+
+    if (builders_ok)
+        std::println("Rotation builders vs std::sin/cos test: PASSED\n");
+    else
+        std::println("Rotation builders vs std::sin/cos test: FAILED\n");
+}
+
+template<typename V, int N>
+bool check_wide_vector(const float* a_values, const float* b_values)
+{
+    using namespace chlm;
+
+    V a, b;
+    for (int i = 0; i < N; ++i)
+    {
+        a[i] = a_values[i];
+        b[i] = b_values[i];
+    }
+
+    float expected_dot{ 0.f }, expected_len_sq{ 0.f };
+    for (int i = 0; i < N; ++i)
+    {
+        expected_dot += a_values[i] * b_values[i];
+        expected_len_sq += a_values[i] * a_values[i];
+    }
+    const float expected_len{ std::sqrt(expected_len_sq) };
+
+    bool passed{ almost_equal(dot(a, b), expected_dot, GENERAL_EPS) &&
+                 almost_equal(length(a), expected_len, GENERAL_EPS) };
+
+    const V n{ normalize(a) };
+    const V l{ lerp(a, b, .25f) };
+    const V lo{ min(a, b) };
+    const V hi{ max(a, b) };
+    const V c{ clamp(a, V{ } - 1.f, V{ } + 2.f) };
+    const V zero{ normalize(V{ }) };
+    for (int i = 0; i < N; ++i)
+    {
+        passed &= almost_equal(n[i], a_values[i] / expected_len);
+        passed &= almost_equal(l[i], a_values[i] + (b_values[i] - a_values[i]) * .25f);
+        passed &= lo[i] == std::min(a_values[i], b_values[i]) && hi[i] == std::max(a_values[i], b_values[i]);
+        passed &= c[i] == std::clamp(a_values[i], -1.f, 2.f);
+        passed &= zero[i] == 0.f;
+    }
+    return passed;
+}
+
+void test_wide_vectors()
+{
+    using namespace chlm;
+
+    std::println("Testing 8- and 16-wide vectors...");
+
+    // Lane i of the wide vectors must match the scalar math on the same values
+    float a_values[16], b_values[16];
+    for (int i = 0; i < 16; ++i)
+    {
+        a_values[i] = std::sin(static_cast<float>(i) * 1.3f) * 4.f;
+        b_values[i] = std::cos(static_cast<float>(i) * .7f) * 3.f - 1.f;
+    }
+
+    if (check_wide_vector<float8, 8>(a_values, b_values) && check_wide_vector<float16, 16>(a_values, b_values))
+        std::println("float8 / float16 vs scalar test: PASSED\n");
+    else
+        std::println("float8 / float16 vs scalar test: FAILED\n");
+}
+
+void test_rsqrt()
+{
+    using namespace chlm;
+
+    std::println("Testing rsqrt / normalize_fast...");
+
+    // Relative error against double precision over several decades
+    float max_rel{ 0.f };
+    for (int i = 0; i < 4000; ++i)
+    {
+        const float x{ std::ldexp(1.f + static_cast<float>(i % 400) / 400.f, i / 400 * 6 - 30) };
+        const float8 r{ rsqrt(float8{ } + x) };
+        const double expected{ 1.0 / std::sqrt(static_cast<double>(x)) };
+        max_rel = std::max({ max_rel, static_cast<float>(std::abs(rsqrt(x) - expected) / expected),
+                             static_cast<float>(std::abs(r[7] - expected) / expected) });
+    }
+
+    // 7 vectors exercise both the 4-wide body and the scalar tail; one is zero
+    std::vector<float3> in;
+    for (int i = 0; i < 7; ++i)
+        in.push_back(i == 5 ? float3{ } : float3{ static_cast<float>(i) - 2.5f, 1.f + i * .3f, -.7f * i });
+    std::vector<float3> fast(in.size()), unsafe(in.size());
+    normalize_fast(std::span<const float3>{ in }, std::span<float3>{ fast });
+    normalize_unsafe(std::span<const float3>{ in }, std::span<float3>{ unsafe });
+
+    const auto is_zero = [](const float3 v) { return v.x == 0.f && v.y == 0.f && v.z == 0.f; };
+    const float4 zero4{ normalize_fast(float4{ }) };
+    bool normalize_ok{ is_zero(normalize_fast(float3{ })) && is_zero(zero4.xyz) && zero4.w == 0.f };
+    for (size_t i = 0; i < in.size(); ++i)
+    {
+        if (i == 5)
+        {
+            normalize_ok &= is_zero(fast[i]);
+            continue;
+        }
+        const float3 expected{ normalize(in[i]) };
+        const float3 single{ normalize_fast(in[i]) };
+        for (int c = 0; c < 3; ++c)
+        {
+            normalize_ok &= almost_equal(fast[i][c], expected[c], 4e-7f);
+            normalize_ok &= almost_equal(unsafe[i][c], expected[c], 4e-7f);
+            normalize_ok &= almost_equal(single[c], expected[c], 4e-7f);
+        }
+    }
+
+    if (max_rel <= 3e-7f && normalize_ok)
+        std::println("rsqrt bound / normalize_fast test: PASSED\n");
+    else
+        std::println("rsqrt bound / normalize_fast test: FAILED (max relative error {})\n", max_rel);
+}
+
+void test_reductions()
+{
+    using namespace chlm;
+
+    std::println("Testing horizontal reductions...");
+
+    // float3 occupies a float4 register; poison the hidden lane to prove it is ignored
+    static_assert(sizeof(float3) == sizeof(float4));
+    const float4 poison_high{ 1.f, -2.f, 5.f, 100.f };
+    const float4 poison_low{ 1.f, -2.f, 5.f, -100.f };
+    float3 high, low;
+    std::memcpy(&high, &poison_high, sizeof(float3));
+    std::memcpy(&low, &poison_low, sizeof(float3));
+
+    const float4 d3{ dot_splat(high, high) };
+    bool passed{ hsum(high) == 4.f && hsum(low) == 4.f && hmin(low) == -2.f && hmax(high) == 5.f &&
+                 dot(low, low) == 30.f && d3.x == 30.f && d3.y == 30.f && d3.z == 30.f && d3.w == 30.f };
+
+    const float4 v4{ 1.f, -2.f, 5.f, 3.f };
+    const float4 s4{ hsum_splat(v4) };
+    const float4 lo4{ hmin_splat(v4) };
+    const float4 hi4{ hmax_splat(v4) };
+    passed &= hsum(v4) == 7.f && hmin(v4) == -2.f && hmax(v4) == 5.f && dot(v4, v4) == 39.f;
+    for (int i = 0; i < 4; ++i)
+        passed &= s4[i] == 7.f && lo4[i] == -2.f && hi4[i] == 5.f;
+
+    // Extremes in the upper half and at the last lane
+    const float8 v8{ 3.f, -1.f, 4.f, 1.f, -5.f, 9.f, 2.f, -6.f };
+    passed &= hsum(v8) == 7.f && hmin(v8) == -6.f && hmax(v8) == 9.f && dot(v8, v8) == 173.f;
+
+    if (passed)
+        std::println("hsum/hmin/hmax float3/float4/float8 test: PASSED\n");
+    else
+        std::println("hsum/hmin/hmax float3/float4/float8 test: FAILED\n");
 }
 
 int main()
@@ -87,8 +1180,27 @@ int main()
     using namespace chlm;
 
     std::println("=== CarrotHLM Validation Test ===\n");
+    std::println("Batch kernel SIMD level: {}\n", simd_level_name(active_simd_level()));
 
     test_inverse();
+    test_float3x4();
+    test_batch_transform();
+    test_soa();
+    test_packed();
+    test_transform_hierarchy();
+    test_frustum_culling();
+    test_aabb();
+    test_raycast();
+    test_bvh();
+    test_quaternion();
+    test_skinning();
+    test_trs();
+    test_quat_compression();
+    test_animation();
+    test_vector_trig();
+    test_wide_vectors();
+    test_reductions();
+    test_rsqrt();
 
     // 1. Vector basics + swizzles
     float4 pos{ 1.f, 2.f, 3.f, 1.f };
@@ -139,7 +1251,7 @@ int main()
                  static_cast<float>(rotated3.z));
 
     float3x3 norm_mat{ normal_matrix(model) };
-    std::println("\nNormal matrix extracted from model (should be scaled inverse rotation)");
+    std::println("\nNormal matrix extracted from model (inverse-transpose: rotation scaled by 1/2)");
 
     // 6. Axis-angle round trip
     const float3 axis{ 1.f, 1.f, 1.f };